@@ -0,0 +1,385 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "game.h"
+#include "game_encoding.h"
+#include "utils/functions/std_utils.h"
+
+// version of the JSON layout, bump it when the fields change so old baselines aren't compared by mistake
+#define BENCH_FORMAT_VERSION 1
+#define BENCH_MAX_REPETITIONS 64
+#define BENCH_MAX_RESULTS 128
+
+static const uint8_t BENCH_BOARD_SIZES[] = {3, 4, 5, 8, 12, 16, 24, 32};
+#define BENCH_NUM_BOARD_SIZES (sizeof(BENCH_BOARD_SIZES) / sizeof(BENCH_BOARD_SIZES[0]))
+
+typedef struct
+{
+    unsigned int warmup_repetitions; // repetitions that run before the measured ones and are thrown away
+    unsigned int repetitions; // measured repetitions, the statistics are computed over them
+    double min_repetition_seconds; // every repetition runs enough operations to take at least this long
+} BenchConfig;
+
+typedef struct
+{
+    const char* name;
+    const char* unit; // "ns/op" or "playouts/s"
+    uint8_t board_size;
+    uint64_t ops_per_repetition;
+    double median;
+    double p10; // 10th percentile
+    double p90; // 90th percentile
+    double best; // fastest repetition (minimum ns/op, maximum playouts/s)
+} BenchResult;
+
+// data prepared before a benchmark, so the measured loop only contains the operation
+typedef struct
+{
+    Game* game; // position with about a quarter of the tiles marked
+    Game* empty_game; // starting position of the random plays
+    Game* scratch; // game the random plays run in
+    BitSet* bitset;
+    uint8_t (*move_buffer)[2];
+    uint16_t* empty_tiles; // empty tiles of the position
+    uint16_t num_empty;
+    uint16_t* marked_tiles; // marked tiles of the position
+    uint16_t num_marked;
+    Game* encoded_game; // copy of the position, the win check and move benchmarks leave it with a different last move
+    uint8_t* encoded; // buffer for one encoded position
+} BenchContext;
+
+// runs an operation num_ops times and returns a checksum, so the compiler can't remove the work
+typedef uint64_t (*BenchFunction)(BenchContext* context, uint64_t num_ops);
+
+// sink for the checksums
+static volatile uint64_t bench_sink;
+
+static uint64_t bench_bitset_get(BenchContext* context, const uint64_t num_ops) {
+    const size_t size = context->bitset->size;
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        checksum += bitset_get(context->bitset, i % size);
+    }
+    return checksum;
+}
+
+static uint64_t bench_bitset_set(BenchContext* context, const uint64_t num_ops) {
+    const size_t size = context->bitset->size;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        bitset_set(context->bitset, i % size);
+    }
+    return context->bitset->bits[0];
+}
+
+static uint64_t bench_bitset_flip(BenchContext* context, const uint64_t num_ops) {
+    const size_t size = context->bitset->size;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        bitset_flip(context->bitset, i % size);
+    }
+    return context->bitset->bits[0];
+}
+
+static uint64_t bench_bitset_clone(BenchContext* context, const uint64_t num_ops) {
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        BitSet* clone = bitset_clone(context->bitset);
+        checksum += clone->bits[0];
+        bitset_free(clone);
+    }
+    return checksum;
+}
+
+static uint64_t bench_bitset_and(BenchContext* context, const uint64_t num_ops) {
+    const Board* board = context->game->board;
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        bitset_and(context->bitset, board->player_one_board, board->player_two_board);
+        checksum += context->bitset->bits[0];
+    }
+    return checksum;
+}
+
+static uint64_t bench_bitset_popcount(BenchContext* context, const uint64_t num_ops) {
+    const BitSet* bitset = context->game->board->player_one_board;
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        checksum += bitset_popcount(bitset);
+    }
+    return checksum;
+}
+
+static uint64_t bench_board_get_legal_moves(BenchContext* context, const uint64_t num_ops) {
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        checksum += board_get_legal_moves(context->move_buffer, context->game->board);
+    }
+    return checksum;
+}
+
+static uint64_t bench_game_is_win(BenchContext* context, const uint64_t num_ops) {
+    Game* game = context->game;
+    uint64_t checksum = 0;
+
+    // the check looks at the lines through the last move, cycle it through all the marked tiles
+    for (uint64_t i = 0; i < num_ops; i++) {
+        const uint16_t tile = context->marked_tiles[i % context->num_marked];
+        game->last_x = tile % game->board->board_size;
+        game->last_y = tile / game->board->board_size;
+        checksum += game_is_win(game);
+    }
+    return checksum;
+}
+
+static uint64_t bench_game_move_un_move(BenchContext* context, const uint64_t num_ops) {
+    Game* game = context->game;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        const uint16_t tile = context->empty_tiles[i % context->num_empty];
+        const uint8_t x = tile % game->board->board_size;
+        const uint8_t y = tile / game->board->board_size;
+        game_move(game, x, y);
+        game_un_move(game, x, y);
+    }
+    return game->hash;
+}
+
+static uint64_t bench_game_random_play(BenchContext* context, const uint64_t num_ops) {
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i++) {
+        game_copy_into(context->scratch, context->empty_game);
+        checksum += (uint64_t)(game_random_play_with_buffer(context->scratch, context->move_buffer) + 1);
+    }
+    return checksum;
+}
+
+// one rollout call covers this many playouts
+#define BENCH_ROLLOUT_ITERATIONS 32
+
+static uint64_t bench_game_rollout(BenchContext* context, const uint64_t num_ops) {
+    float checksum = 0;
+    for (uint64_t i = 0; i < num_ops; i += BENCH_ROLLOUT_ITERATIONS) {
+        checksum += game_rollout(context->empty_game, BENCH_ROLLOUT_ITERATIONS);
+    }
+    return (uint64_t)(checksum * 1000);
+}
+
+static uint64_t bench_game_encode_decode(BenchContext* context, const uint64_t num_ops) {
+    for (uint64_t i = 0; i < num_ops; i++) {
+        game_encode(context->encoded_game, context->encoded);
+        game_decode(context->scratch, context->encoded);
+    }
+    return context->scratch->hash;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    const double first = *(const double*)a;
+    const double second = *(const double*)b;
+    return (first > second) - (first < second);
+}
+
+/**
+ * Return a percentile of sorted values, interpolating between the two closest ones.
+ */
+static double percentile(const double* sorted, const unsigned int count, const double fraction) {
+    const double position = fraction * (count - 1);
+    const unsigned int lower = (unsigned int)position;
+    const unsigned int upper = lower + 1 < count ? lower + 1 : lower;
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - lower);
+}
+
+/**
+ * Measure a benchmark. The number of operations per repetition is doubled until one repetition takes long enough for
+ * the clock resolution not to matter, then the warmup and the measured repetitions run with that count.
+ * @param op_granularity Operations are counted in multiples of this (e.g. playouts per rollout call).
+ */
+static BenchResult bench_run(const char* name, const char* unit, const uint8_t board_size, BenchFunction function,
+                             BenchContext* context, const BenchConfig* config, const uint64_t op_granularity) {
+    uint64_t num_ops = op_granularity;
+    while (true) {
+        const double start = seconds_now();
+        bench_sink += function(context, num_ops);
+        if (seconds_now() - start >= config->min_repetition_seconds) {
+            break;
+        }
+        num_ops *= 2;
+    }
+
+    for (unsigned int i = 0; i < config->warmup_repetitions; i++) {
+        bench_sink += function(context, num_ops);
+    }
+
+    double ns_per_op[BENCH_MAX_REPETITIONS];
+    for (unsigned int i = 0; i < config->repetitions; i++) {
+        const double start = seconds_now();
+        bench_sink += function(context, num_ops);
+        ns_per_op[i] = (seconds_now() - start) * 1e9 / (double)num_ops;
+    }
+    qsort(ns_per_op, config->repetitions, sizeof(double), compare_doubles);
+
+    BenchResult result;
+    result.name = name;
+    result.unit = unit;
+    result.board_size = board_size;
+    result.ops_per_repetition = num_ops;
+
+    // rates are the inverse of the times, so the low percentile of the time is the high percentile of the rate
+    if (strcmp(unit, "playouts/s") == 0) {
+        result.median = 1e9 / percentile(ns_per_op, config->repetitions, 0.5);
+        result.p10 = 1e9 / percentile(ns_per_op, config->repetitions, 0.9);
+        result.p90 = 1e9 / percentile(ns_per_op, config->repetitions, 0.1);
+        result.best = 1e9 / ns_per_op[0];
+    }
+    else {
+        result.median = percentile(ns_per_op, config->repetitions, 0.5);
+        result.p10 = percentile(ns_per_op, config->repetitions, 0.1);
+        result.p90 = percentile(ns_per_op, config->repetitions, 0.9);
+        result.best = ns_per_op[0];
+    }
+
+    fprintf(stderr, "%-24s %3dx%-3d %14.2f %s (p10 %.2f, p90 %.2f)\n", name, board_size, board_size, result.median,
+            unit, result.p10, result.p90);
+    return result;
+}
+
+/**
+ * Create the benchmark data for a board size. The position gets a quarter of the tiles (in a random order) marked, so
+ * the board operations see a realistic mix of empty and marked tiles. The random plays start from the empty board.
+ */
+static BenchContext bench_context_create(const uint8_t board_size) {
+    BenchContext context;
+    const uint16_t num_tiles = board_size * board_size;
+
+    context.game = game_create(board_size);
+    context.empty_game = game_create(board_size);
+    context.scratch = game_create(board_size);
+    context.bitset = bitset_create(num_tiles);
+    context.move_buffer = malloc(num_tiles * sizeof(*context.move_buffer));
+    context.empty_tiles = malloc(num_tiles * sizeof(uint16_t));
+    context.marked_tiles = malloc(num_tiles * sizeof(uint16_t));
+    context.encoded = malloc(game_encoded_size(board_size));
+    if (context.move_buffer == NULL || context.empty_tiles == NULL || context.marked_tiles == NULL ||
+        context.encoded == NULL) {
+        throw_err("bench_context_create", "Couldn't allocate memory for the benchmark data.");
+    }
+
+    const uint16_t num_legal_moves = board_get_legal_moves(context.move_buffer, context.game->board);
+    board_shuffle_moves(context.move_buffer, num_legal_moves);
+    for (uint16_t i = 0; i < num_tiles / 4 + 1; i++) {
+        game_move(context.game, context.move_buffer[i][0], context.move_buffer[i][1]);
+    }
+
+    context.encoded_game = game_clone(context.game);
+    context.num_empty = board_get_legal_tiles(context.empty_tiles, context.game->board);
+    context.num_marked = 0;
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        if (board_get_index(context.game->board, i) != EMPTY) {
+            context.marked_tiles[context.num_marked++] = i;
+        }
+    }
+
+    return context;
+}
+
+static void bench_context_free(BenchContext* context) {
+    game_free(context->game);
+    game_free(context->empty_game);
+    game_free(context->scratch);
+    game_free(context->encoded_game);
+    bitset_free(context->bitset);
+    free(context->move_buffer);
+    free(context->empty_tiles);
+    free(context->marked_tiles);
+    free(context->encoded);
+}
+
+static void write_json(FILE* file, const BenchConfig* config, const BenchResult* results, const unsigned int count) {
+    fprintf(file, "{\n");
+    fprintf(file, "  \"format_version\": %d,\n", BENCH_FORMAT_VERSION);
+    fprintf(file, "  \"repetitions\": %u,\n", config->repetitions);
+    fprintf(file, "  \"warmup_repetitions\": %u,\n", config->warmup_repetitions);
+    fprintf(file, "  \"results\": [\n");
+
+    for (unsigned int i = 0; i < count; i++) {
+        const BenchResult* result = &results[i];
+        fprintf(file,
+                "    {\"name\": \"%s\", \"board_size\": %d, \"unit\": \"%s\", \"median\": %.3f, \"p10\": %.3f, "
+                "\"p90\": %.3f, \"best\": %.3f, \"ops_per_repetition\": %llu}%s\n",
+                result->name, result->board_size, result->unit, result->median, result->p10, result->p90, result->best,
+                (unsigned long long)result->ops_per_repetition, i + 1 < count ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+}
+
+// usage: oxox_bench [--quick] [--output <file>]
+int main(const int argc, char** argv) {
+    BenchConfig config = {.warmup_repetitions = 3, .repetitions = 21, .min_repetition_seconds = 0.01};
+    const char* output_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            config = (BenchConfig){.warmup_repetitions = 1, .repetitions = 5, .min_repetition_seconds = 0.002};
+        }
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output_path = argv[++i];
+        }
+        else {
+            println("Usage: %s [--quick] [--output <file>]", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // the same positions in every run, so the results are comparable
+    srand(1);
+
+    BenchResult* results = malloc(BENCH_MAX_RESULTS * sizeof(BenchResult));
+    if (results == NULL) {
+        throw_err("main", "Couldn't allocate memory for the results.");
+    }
+    unsigned int count = 0;
+
+    for (size_t i = 0; i < BENCH_NUM_BOARD_SIZES; i++) {
+        const uint8_t size = BENCH_BOARD_SIZES[i];
+        BenchContext context = bench_context_create(size);
+
+        results[count++] = bench_run("bitset_get", "ns/op", size, bench_bitset_get, &context, &config, 1);
+        results[count++] = bench_run("bitset_set", "ns/op", size, bench_bitset_set, &context, &config, 1);
+        results[count++] = bench_run("bitset_flip", "ns/op", size, bench_bitset_flip, &context, &config, 1);
+        results[count++] = bench_run("bitset_clone", "ns/op", size, bench_bitset_clone, &context, &config, 1);
+        results[count++] = bench_run("bitset_and", "ns/op", size, bench_bitset_and, &context, &config, 1);
+        results[count++] = bench_run("bitset_popcount", "ns/op", size, bench_bitset_popcount, &context, &config, 1);
+        results[count++] = bench_run("board_get_legal_moves", "ns/op", size, bench_board_get_legal_moves, &context,
+                                     &config, 1);
+        results[count++] = bench_run("game_is_win", "ns/op", size, bench_game_is_win, &context, &config, 1);
+        results[count++] = bench_run("game_move_un_move", "ns/op", size, bench_game_move_un_move, &context, &config,
+                                     1);
+        results[count++] = bench_run("game_encode_decode", "ns/op", size, bench_game_encode_decode, &context,
+                                     &config, 1);
+        results[count++] = bench_run("game_random_play", "playouts/s", size, bench_game_random_play, &context,
+                                     &config, 1);
+        results[count++] = bench_run("game_rollout", "playouts/s", size, bench_game_rollout, &context, &config,
+                                     BENCH_ROLLOUT_ITERATIONS);
+
+        bench_context_free(&context);
+    }
+
+    FILE* output = stdout;
+    if (output_path != NULL) {
+        output = fopen(output_path, "w");
+        if (output == NULL) {
+            throw_err("main", "Couldn't create the file %s.", output_path);
+        }
+    }
+
+    write_json(output, &config, results, count);
+
+    if (output != stdout) {
+        fclose(output);
+    }
+    free(results);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,52 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef ARENA_H
+#define ARENA_H
+
+// this import IS NOT unused, it is the source of the size_t data type
+// ReSharper disable once CppUnusedIncludeDirective
+#include <stddef.h>
+
+typedef struct ArenaChunk ArenaChunk;
+
+/**
+ * Bump allocator for objects that are created in bulk and thrown away together. Memory is handed out from large
+ * chunks, there's no per-object free, and a reset makes all the chunks reusable at once.
+ */
+typedef struct
+{
+    ArenaChunk* first; // first chunk in the list
+    ArenaChunk* current; // chunk the allocations are currently taken from
+    size_t chunk_capacity; // default number of bytes in a chunk
+} OxoxArena;
+
+/**
+ * Allocate a new arena.
+ * @param chunk_capacity Number of bytes reserved at once. Larger allocations get a chunk of their own.
+ * @return Pointer to the arena.
+ */
+OxoxArena* oxox_arena_create(size_t chunk_capacity);
+
+/**
+ * Reserve memory in the arena. The memory is aligned for any type and isn't initialized.
+ * @param arena Arena to allocate from.
+ * @param size Number of bytes to reserve.
+ * @return Pointer to the memory, valid until the arena is reset or freed.
+ */
+void* oxox_arena_alloc(OxoxArena* arena, size_t size);
+
+/**
+ * Release every allocation at once. The chunks stay reserved and are reused by later allocations.
+ * @param arena Arena to reset.
+ */
+void oxox_arena_reset(OxoxArena* arena);
+
+/**
+ * Free the arena and all the memory allocated from it.
+ * @param arena Pointer to the arena.
+ */
+void oxox_arena_free(OxoxArena* arena);
+
+#endif //ARENA_H
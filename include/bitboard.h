@@ -0,0 +1,117 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include "board.h"
+
+// largest board (along one axis) that fits into the inline bitboard representation
+#define BITBOARD_MAX_SIZE 16
+// number of 64-bit words reserved for each player (4 x 64 = 256 tiles = 16x16)
+#define BITBOARD_MAX_WORDS 4
+
+/**
+ * Fixed-width board for sizes up to 16x16. Both players' marks are stored inline as 64, 128 or 256-bit words, so the
+ * struct can be copied by value (no allocation, no pointers to chase). Tile (x, y) maps to bit y * board_size + x,
+ * same as in Board. Words past num_words and bits past board_size^2 are always 0.
+ */
+typedef struct
+{
+    uint64_t player_one_board[BITBOARD_MAX_WORDS];
+    uint64_t player_two_board[BITBOARD_MAX_WORDS];
+    uint8_t board_size;
+    uint8_t num_words; // number of words in use (1, 2 or 4)
+} BitBoard;
+
+// directions of the XOX and OXO patterns, each pattern is identified by its starting tile and direction
+typedef enum
+{
+    HORIZONTAL = 0, // (x, y), (x + 1, y), (x + 2, y)
+    VERTICAL = 1, // (x, y), (x, y + 1), (x, y + 2)
+    DIAGONAL = 2, // (x, y), (x + 1, y + 1), (x + 2, y + 2)
+    ANTI_DIAGONAL = 3, // (x, y), (x - 1, y + 1), (x - 2, y + 2)
+} LineDirection;
+
+#define NUM_LINE_DIRECTIONS 4
+
+/**
+ * Create an empty bitboard. Cloning is a plain struct copy (e.g. BitBoard clone = original;).
+ * @param board_size Number of tiles along one axis, at most BITBOARD_MAX_SIZE.
+ * @return The bitboard (by value).
+ */
+BitBoard bitboard_create(uint8_t board_size);
+
+/**
+ * Convert a heap-allocated board into the inline representation.
+ * @param board Board to read from. Its size must be at most BITBOARD_MAX_SIZE.
+ * @return Bitboard with the same position.
+ */
+BitBoard bitboard_from_board(const Board* board);
+
+/**
+ * Write the position of a bitboard into a heap-allocated board.
+ * @param bitboard Bitboard to read from.
+ * @param board Pre-allocated board of the same size. All of its tiles are overwritten.
+ */
+void bitboard_to_board(const BitBoard* bitboard, const Board* board);
+
+/**
+ * Return which player occupies a tile or if it's empty.
+ * @param bitboard Bitboard to read from.
+ * @param x X coordinate of the tile.
+ * @param y Y coordinate of the tile.
+ * @return What mark is on the tile.
+ */
+PlayerMark bitboard_get(const BitBoard* bitboard, uint8_t x, uint8_t y);
+
+/**
+ * Assign a tile to a player or clear it.
+ * @param bitboard Bitboard to change the tile in.
+ * @param x X coordinate of the tile.
+ * @param y Y coordinate of the tile.
+ * @param mark How the tile should be marked.
+ */
+void bitboard_set(BitBoard* bitboard, uint8_t x, uint8_t y, PlayerMark mark);
+
+/**
+ * Check if a tile is occupied by any player (a single word operation).
+ * @param bitboard Bitboard to read from.
+ * @param index Index of the tile (y * board_size + x).
+ * @return True if the tile is occupied, false if it's empty.
+ */
+bool bitboard_is_occupied(const BitBoard* bitboard, uint16_t index);
+
+/**
+ * Count the occupied tiles.
+ * @param bitboard Bitboard to read from.
+ * @return Number of tiles marked by either player.
+ */
+uint16_t bitboard_count_occupied(const BitBoard* bitboard);
+
+/**
+ * Find every XOX and OXO pattern on the board in all four directions at once. The search shifts the player words and
+ * ANDs them together, edge masks discard patterns that would wrap around the board.
+ * @param bitboard Bitboard to search.
+ * @param patterns Output masks, one per direction (indexed by LineDirection). Bit i is set if a pattern starts at
+ *                 tile i and continues in that direction.
+ */
+void bitboard_find_patterns(const BitBoard* bitboard, uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS]);
+
+/**
+ * Return the mask of tiles where a pattern in a direction can start without wrapping around the board edge.
+ * @param board_size Size of the board along one axis (3 to BITBOARD_MAX_SIZE).
+ * @param direction Direction of the patterns.
+ * @return Array of BITBOARD_MAX_WORDS words, valid for the lifetime of the program.
+ */
+const uint64_t* bitboard_edge_mask(uint8_t board_size, LineDirection direction);
+
+/**
+ * Check if there's any XOX or OXO pattern on the board. Unlike game_is_win, it doesn't depend on the last move.
+ * @param bitboard Bitboard to evaluate.
+ * @return True if the position is winning, false otherwise.
+ */
+bool bitboard_is_win(const BitBoard* bitboard);
+
+#endif //BITBOARD_H
@@ -10,12 +10,37 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include <stddef.h>
 
+// alignment (in bytes) of the data of every bitset created by bitset_create or bitset_clone
+#define BITSET_ALIGNMENT 32
+// returned by the searches when there's no set bit
+#define BITSET_NOT_FOUND SIZE_MAX
+
 typedef struct
 {
-    uint8_t* bits; // pointer to array of bytes
-    size_t size; // number of bits in the bitset
+    uint64_t* bits; // pointer to array of 64-bit words, bit i is bit i % 64 of word i / 64
+    size_t size; // number of bits in the bitset, the bits of the last word past the size are always 0
 } BitSet;
 
+/**
+ * Return the number of words that hold the bits of a bitset.
+ * @param size Number of bits in the bitset.
+ * @return Number of 64-bit words.
+ */
+static inline size_t bitset_num_words(const size_t size) {
+    return (size + 63) / 64;
+}
+
+/**
+ * Return the number of words reserved for the data of a bitset. It's rounded up to a multiple of BITSET_ALIGNMENT, so
+ * the data of several bitsets can be placed one after another and all of them stay aligned.
+ * @param size Number of bits in the bitset.
+ * @return Number of 64-bit words.
+ */
+static inline size_t bitset_reserved_words(const size_t size) {
+    const size_t words_per_block = BITSET_ALIGNMENT / sizeof(uint64_t);
+    return (bitset_num_words(size) + words_per_block - 1) / words_per_block * words_per_block;
+}
+
 /**
  * Allocate a new bitset with all bits set to 0.
  * @param size Number of bits in the bitset.
@@ -30,6 +55,13 @@ BitSet* bitset_create(size_t size);
  */
 BitSet* bitset_clone(const BitSet* original);
 
+/**
+ * Copy the data of one bitset into another without allocating memory.
+ * @param target Bitset to overwrite. Must have the same size as the source.
+ * @param source Bitset to copy the data from.
+ */
+void bitset_copy_into(const BitSet* target, const BitSet* source);
+
 /**
  * Free the memory allocated for the bitset.
  * @param bitset Pointer to the memory.
@@ -65,6 +97,84 @@ void bitset_flip(const BitSet* bitset, size_t index);
  */
 bool bitset_get(const BitSet* bitset, size_t index);
 
+/**
+ * Set every bit of the target to the AND of the bits of two bitsets. Large bitsets are processed with SIMD instructions
+ * when the CPU supports them.
+ * @param target Bitset to overwrite, it can be one of the operands.
+ * @param left First operand.
+ * @param right Second operand.
+ */
+void bitset_and(const BitSet* target, const BitSet* left, const BitSet* right);
+
+/**
+ * Set every bit of the target to the OR of the bits of two bitsets.
+ * @param target Bitset to overwrite, it can be one of the operands.
+ * @param left First operand.
+ * @param right Second operand.
+ */
+void bitset_or(const BitSet* target, const BitSet* left, const BitSet* right);
+
+/**
+ * Set every bit of the target to the XOR of the bits of two bitsets.
+ * @param target Bitset to overwrite, it can be one of the operands.
+ * @param left First operand.
+ * @param right Second operand.
+ */
+void bitset_xor(const BitSet* target, const BitSet* left, const BitSet* right);
+
+/**
+ * Set every bit of the target to 1 where the left bitset has a 1 and the right one has a 0 (left AND NOT right).
+ * @param target Bitset to overwrite, it can be one of the operands.
+ * @param left Bitset to take the bits from.
+ * @param right Bitset of the bits to remove.
+ */
+void bitset_andnot(const BitSet* target, const BitSet* left, const BitSet* right);
+
+/**
+ * Set every bit of the target to the inverse of the source's bit.
+ * @param target Bitset to overwrite, it can be the source.
+ * @param source Bitset to invert.
+ */
+void bitset_not(const BitSet* target, const BitSet* source);
+
+/**
+ * Count the bits set to 1.
+ * @param bitset Bitset to count in.
+ * @return Number of set bits.
+ */
+size_t bitset_popcount(const BitSet* bitset);
+
+/**
+ * Find the lowest set bit.
+ * @param bitset Bitset to search.
+ * @return Index of the bit, or BITSET_NOT_FOUND if no bit is set.
+ */
+size_t bitset_find_first_set(const BitSet* bitset);
+
+/**
+ * Find the lowest set bit after an index. Together with bitset_find_first_set it iterates over the set bits:
+ * for (size_t i = bitset_find_first_set(b); i != BITSET_NOT_FOUND; i = bitset_find_next_set(b, i)).
+ * @param bitset Bitset to search.
+ * @param index Index to search after (the bit at the index itself isn't included).
+ * @return Index of the bit, or BITSET_NOT_FOUND if no later bit is set.
+ */
+size_t bitset_find_next_set(const BitSet* bitset, size_t index);
+
+/**
+ * Compare two bitsets.
+ * @param left First bitset.
+ * @param right Second bitset.
+ * @return True if both have the same size and the same bits.
+ */
+bool bitset_equals(const BitSet* left, const BitSet* right);
+
+/**
+ * Hash the size and the bits of a bitset. Equal bitsets have equal hashes.
+ * @param bitset Bitset to hash.
+ * @return The hash.
+ */
+uint64_t bitset_hash(const BitSet* bitset);
+
 /**
  * Return a string representation of the bitset in binary form.
  * @param bitset The bitset to represent as a string.
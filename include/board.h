@@ -6,6 +6,7 @@
 #define BOARD_H
 
 #include "bitset.h"
+#include "rng.h"
 
 typedef struct
 {
@@ -35,6 +36,13 @@ Board* board_create(uint8_t board_size);
  */
 Board* board_clone(const Board* original);
 
+/**
+ * Copy a board position into another board without allocating memory.
+ * @param target Board to overwrite. Must have the same size as the source.
+ * @param source Board to copy the data from.
+ */
+void board_copy_into(const Board* target, const Board* source);
+
 /**
  * Free the allocated memory for the board.
  * @param board Pointer to the board.
@@ -50,6 +58,14 @@ void board_free(Board* board);
  */
 PlayerMark board_get(const Board* board, uint8_t x, uint8_t y);
 
+/**
+ * Return which player occupies a tile or if it's empty, addressing the tile by its index.
+ * @param board Pointer to the board.
+ * @param index Index of the tile (y * board_size + x).
+ * @return What mark is on the tile.
+ */
+PlayerMark board_get_index(const Board* board, uint16_t index);
+
 /**
  * Assign a tile to a player or clear it.
  * @param board Board to change the tile in.
@@ -69,11 +85,21 @@ void board_set(const Board* board, uint8_t x, uint8_t y, PlayerMark mark);
 bool board_coordinates_in_bounds(const Board* board, short x, short y);
 
 /**
- * Register all legal moves in a board position.
+ * Register all legal moves in a board position. The empty tiles are found a word at a time by scanning the inverted
+ * occupancy of both players for set bits.
  * @param move_buffer A 2D array (num_legal_moves x 2 for x and y coordinates) that will be filled with legal moves. Must have large enough capacity.
  * @param board Board to search for legal moves in.
+ * @return Number of legal moves written to the buffer.
  */
-void board_get_legal_moves(uint8_t move_buffer[][2], const Board* board);
+uint16_t board_get_legal_moves(uint8_t move_buffer[][2], const Board* board);
+
+/**
+ * Register all legal moves in a board position as flat tile indices (y * board_size + x), in increasing order.
+ * @param tile_buffer Array that will be filled with the tile indices. Must have large enough capacity.
+ * @param board Board to search for legal moves in.
+ * @return Number of legal moves written to the buffer.
+ */
+uint16_t board_get_legal_tiles(uint16_t* tile_buffer, const Board* board);
 
 /**
  * Shuffle an array of moves by randomly swapping elements (in-place operation).
@@ -82,6 +108,14 @@ void board_get_legal_moves(uint8_t move_buffer[][2], const Board* board);
  */
 void board_shuffle_moves(uint8_t move_array[][2], uint16_t length);
 
+/**
+ * Shuffle an array of moves uniformly (Fisher-Yates) with a caller-owned generator instead of rand().
+ * @param move_array 2D array (length x 2 for x and y coordinates) with the moves to shuffle. It holds the shuffled data after the function finishes (will be modified).
+ * @param length Number of moves in the array.
+ * @param rng Generator to draw the random numbers from.
+ */
+void board_shuffle_moves_rng(uint8_t move_array[][2], uint16_t length, Rng* rng);
+
 /**
  * Return a string representation of the board state.
  * @param board Board to read from.
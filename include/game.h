@@ -5,8 +5,17 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include "arena.h"
 #include "board.h"
 
+// one move of the history, enough to take the move back and restore the move before it
+typedef struct
+{
+    uint16_t tile; // index of the tile the move was played at (y * board_size + x)
+    uint8_t previous_last_x; // last_x before the move
+    uint8_t previous_last_y; // last_y before the move
+} GameHistoryEntry;
+
 typedef struct
 {
     Board* board;
@@ -14,8 +23,19 @@ typedef struct
     uint8_t last_x; // X coordinate of the last move
     uint8_t last_y; // Y coordinate of the last move
     PlayerMark current_player;
+    uint64_t hash; // Zobrist hash of the position, recompute it with game_compute_hash after editing the board directly
+    GameHistoryEntry* history; // moves since the history was enabled (room for board_size^2), NULL when disabled
+    uint16_t history_length; // number of moves in the history
+    bool in_arena; // true when the game was placed in an arena block by game_create_in or game_clone_in
 } Game;
 
+// reusable memory for rollouts, so the iterations don't have to allocate anything
+typedef struct
+{
+    Game* game; // target the rolled out position is copied into before every play
+    uint8_t (*move_buffer)[2]; // room for every tile of the board (board_size^2 x 2 for x and y coordinates)
+} RolloutScratch;
+
 /**
  * Allocate memory for a new game with all tiles empty.
  * @param board_size Size of the board along one axis (e.g. 8 -> 8x8 board).
@@ -24,12 +44,38 @@ typedef struct
 Game* game_create(uint8_t board_size);
 
 /**
- * Deep copy a game.
+ * Deep copy a game, including its history.
  * @param original Game to copy the data from (it won't be modified in the process).
  * @return Pointer to a new allocated game.
  */
 Game* game_clone(const Game* original);
 
+/**
+ * Create a new game with all tiles empty inside an arena. The game, its board and both bitsets (with their data) are
+ * placed in one contiguous block. The game must not be passed to game_free, it lives until the arena is reset or freed.
+ * @param arena Arena to allocate from.
+ * @param board_size Size of the board along one axis (e.g. 8 -> 8x8 board).
+ * @return Pointer to the created game.
+ */
+Game* game_create_in(OxoxArena* arena, uint8_t board_size);
+
+/**
+ * Deep copy a game into an arena. When the original was also created in an arena, the board data of both players is
+ * copied with a single memcpy. The history isn't copied.
+ * @param arena Arena to allocate from.
+ * @param original Game to copy the data from (it won't be modified in the process).
+ * @return Pointer to the new game, with the same lifetime rules as in game_create_in.
+ */
+Game* game_clone_in(OxoxArena* arena, const Game* original);
+
+/**
+ * Copy a game into another game without allocating memory. The history is copied if both games have it enabled,
+ * otherwise the target's history (if any) is emptied.
+ * @param target Game to overwrite. Must have the same board size as the source.
+ * @param source Game to copy the data from.
+ */
+void game_copy_into(Game* target, const Game* source);
+
 /**
  * Free the allocated memory for a game.
  * @param game Pointer to the game to free.
@@ -47,13 +93,45 @@ void game_move(Game* game, uint8_t x, uint8_t y);
 
 /**
  * Revert a move on the board. This includes clearing the tile, decrease the move count and switching the active player.
- * A limitation is that the game won't remember the previous last made move.
+ * With the history enabled, only the last move can be reverted and the move before it becomes the last move again.
+ * Without it, the game doesn't remember the previous last move and the coordinates are reset to (0, 0).
  * @param game Game where move was previously made.
  * @param x X coordinate of the tile to clear.
  * @param y Y coordinate of the tile to clear.
  */
 void game_un_move(Game* game, uint8_t x, uint8_t y);
 
+/**
+ * Take back the last move recorded in the history in O(1), restoring the exact previous state (including the last
+ * move, so game_is_win works after it).
+ * @param game Game with the history enabled and at least one move in it.
+ */
+void game_undo(Game* game);
+
+/**
+ * Start recording the moves of a game, so they can be taken back with game_undo. The history has room for a move on
+ * every tile, so it never overflows. Moves made before enabling it aren't recorded.
+ * @param game Game to record. Does nothing if the history is already enabled.
+ */
+void game_enable_history(Game* game);
+
+/**
+ * Stop recording the moves of a game and free the history. game_free does this as well, but games from an arena have
+ * to call it before the arena is reset.
+ * @param game Game to stop recording.
+ */
+void game_disable_history(Game* game);
+
+/**
+ * Compute the Zobrist hash of a position from scratch. Every (tile, player) pair has its own pseudo-random 64-bit key
+ * and the hash is the XOR of a key of the board size, the keys of all marked tiles and a side-to-move key when O is to
+ * move. game_move and
+ * game_un_move update game->hash in O(1), so this is only needed after editing the board directly, or to check it.
+ * @param game Game position to hash.
+ * @return The 64-bit hash. Equal positions with the same player to move always have equal hashes.
+ */
+uint64_t game_compute_hash(const Game* game);
+
 /**
  * Check if the current position is a tie. The result purely depends on the turnsTaken property, and won't work when set incorrectly.
  * @param game Game position to evaluate.
@@ -69,13 +147,40 @@ bool game_is_tie(const Game* game);
  */
 bool game_is_win(const Game* game);
 
+/**
+ * Check if there's an XOX or OXO pattern anywhere on the board. Unlike game_is_win, the result doesn't depend on the
+ * last recorded move. Boards up to BITBOARD_MAX_SIZE use the bit-parallel pattern search.
+ * @param game Game position to evaluate.
+ * @return True if the position is winning, false otherwise.
+ */
+bool game_is_win_full(const Game* game);
+
 /**
  * Play randomly until the game ends and return the value of the position from the perspective of the starting player.
+ * The whole board is checked for wins, so a position that is already won ends the play immediately. The moves are
+ * drawn lazily (one Fisher-Yates step per move), which is distributed the same as shuffling all of them up front.
  * @param game Game position to play from. The game instance will be modified.
  * @return 1 if the starting player won, -1 if he lost, 0 for draw.
  */
 float game_random_play(Game* game);
 
+/**
+ * Same as game_random_play, but the moves are gathered into a caller-owned buffer instead of a temporary allocation.
+ * @param game Game position to play from. The game instance will be modified.
+ * @param move_buffer Buffer with room for all the legal moves (board_size^2 x 2 is always enough).
+ * @return 1 if the starting player won, -1 if he lost, 0 for draw.
+ */
+float game_random_play_with_buffer(Game* game, uint8_t move_buffer[][2]);
+
+/**
+ * Same as game_random_play_with_buffer, but the moves are shuffled with a caller-owned generator instead of rand().
+ * @param game Game position to play from. The game instance will be modified.
+ * @param move_buffer Buffer with room for all the legal moves (board_size^2 x 2 is always enough).
+ * @param rng Generator to draw the random numbers from.
+ * @return 1 if the starting player won, -1 if he lost, 0 for draw.
+ */
+float game_random_play_rng(Game* game, uint8_t move_buffer[][2], Rng* rng);
+
 /**
  * Estimate the value of this game position by performing "n" number of random plays and averaging the game results.
  * @param position Starting position for all the simulations.
@@ -84,4 +189,49 @@ float game_random_play(Game* game);
  */
 float game_rollout(const Game* position, unsigned int num_iterations);
 
+/**
+ * Same as game_rollout_with_scratch, but the plays use a caller-owned generator instead of rand().
+ * @param position Starting position for all the simulations.
+ * @param num_iterations Number of simulations to perform from the starting position.
+ * @param scratch Scratch memory created for the board size of the position.
+ * @param rng Generator to draw the random numbers from.
+ * @return Average game result score from the simulations.
+ */
+float game_rollout_rng(const Game* position, unsigned int num_iterations, RolloutScratch* scratch, Rng* rng);
+
+/**
+ * Estimate the value of a position like game_rollout, but split the random plays across multiple threads. Every thread
+ * plays on its own copy of the position with its own stream split from a generator seeded with the seed, so the result
+ * is identical for the same seed and number of threads. Boards up to PLAYOUT_BATCH_MAX_SIZE are played in SIMD batches.
+ * @param position Starting position for all the simulations. It's only read, so it must not change during the call.
+ * @param num_iterations Number of simulations to perform from the starting position.
+ * @param num_threads Number of threads to use (including the calling thread).
+ * @param seed Seed for the random plays.
+ * @return Average game result score from the simulations.
+ */
+float game_rollout_parallel(const Game* position, unsigned int num_iterations, unsigned int num_threads,
+                            uint64_t seed);
+
+/**
+ * Allocate reusable rollout memory for one board size.
+ * @param board_size Size of the board along one axis.
+ * @return Pointer to the scratch memory.
+ */
+RolloutScratch* rollout_scratch_create(uint8_t board_size);
+
+/**
+ * Free the rollout memory.
+ * @param scratch Pointer to the scratch memory.
+ */
+void rollout_scratch_free(RolloutScratch* scratch);
+
+/**
+ * Same as game_rollout, but every iteration reuses the scratch memory, so no allocations happen during the rollout.
+ * @param position Starting position for all the simulations.
+ * @param num_iterations Number of simulations to perform from the starting position.
+ * @param scratch Scratch memory created for the board size of the position.
+ * @return Average game result score from the simulations.
+ */
+float game_rollout_with_scratch(const Game* position, unsigned int num_iterations, RolloutScratch* scratch);
+
 #endif //GAME_H
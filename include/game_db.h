@@ -0,0 +1,84 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef GAME_DB_H
+#define GAME_DB_H
+
+#include "game.h"
+
+// largest board the database supports, a 5x5 board has 3^25 (~8.5 * 10^11) indices, which is ~200 GB even at 2 bits
+#define GAME_DB_MAX_SIZE 4
+// format version written into the file header, files with a different version are rejected
+#define GAME_DB_VERSION 1
+
+// exact value of a position from the perspective of the player to move, stored in 2 bits
+typedef enum
+{
+    DB_UNKNOWN = 0, // the position can't be reached in a game
+    DB_DRAW = 1,
+    DB_WIN = 2,
+    DB_LOSS = 3, // also used for positions that are already won by the previous player
+} GameDbValue;
+
+// file header, followed by the values (4 per byte, position i in bits 2 * (i % 4) of byte i / 4)
+typedef struct
+{
+    char magic[8]; // "OXOXDB" padded with zeros
+    uint32_t version;
+    uint8_t board_size;
+    uint8_t reserved[3];
+    uint64_t num_positions; // 3^(board_size^2)
+} GameDbHeader;
+
+/**
+ * Read-only database of solved positions, memory-mapped from a file.
+ */
+typedef struct
+{
+    void* mapping; // start of the mapped file
+    size_t mapped_size;
+    const uint8_t* values; // packed values, right after the header
+    uint64_t num_positions;
+    uint8_t board_size;
+} GameDb;
+
+/**
+ * Compute the perfect index of a position. Tile i is digit i of a base-3 number (0 = empty, 1 = X, 2 = O), so every
+ * position has its own index in [0, 3^(board_size^2)).
+ * @param game Position to index. Its board size must be at most GAME_DB_MAX_SIZE.
+ * @return The index.
+ */
+uint64_t game_db_index(const Game* game);
+
+/**
+ * Solve every reachable position of a board size by retrograde analysis and write the values into a file. A move
+ * always raises the base-3 index, so a forward pass in increasing index order marks the reachable positions and a
+ * backward pass in decreasing order assigns the values, with all children of a position already known.
+ * @param board_size Size of the board along one axis, at most GAME_DB_MAX_SIZE.
+ * @param path Path of the file to create (it's overwritten if it exists).
+ */
+void game_db_build(uint8_t board_size, const char* path);
+
+/**
+ * Memory-map a database file. The values aren't parsed or copied, the pages are loaded by the OS on first use.
+ * @param path Path of a file created by game_db_build.
+ * @return Pointer to the database.
+ */
+GameDb* game_db_open(const char* path);
+
+/**
+ * Unmap a database and free its memory.
+ * @param db Pointer to the database.
+ */
+void game_db_close(GameDb* db);
+
+/**
+ * Look up the exact value of a position in O(1).
+ * @param db Database of the same board size as the game.
+ * @param game Position to look up.
+ * @return Value from the perspective of the player to move, DB_UNKNOWN for positions that can't occur in a game.
+ */
+GameDbValue game_db_lookup(const GameDb* db, const Game* game);
+
+#endif //GAME_DB_H
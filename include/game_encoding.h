@@ -0,0 +1,80 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef GAME_ENCODING_H
+#define GAME_ENCODING_H
+
+#include "game.h"
+
+// format version written into every encoded position, positions with a different version are rejected
+#define GAME_ENCODING_VERSION 1
+
+/**
+ * Fixed-size header of an encoded position. It's followed by the tiles of X and then the tiles of O, each packed into
+ * (board_size^2 + 7) / 8 bytes (tile i in bit i % 8 of byte i / 8, so the bytes are the bitboard words in little-endian
+ * order). All the fields are single bytes, so the format doesn't depend on the byte order of the machine.
+ */
+typedef struct
+{
+    uint8_t version;
+    uint8_t board_size;
+    uint8_t turns_taken[2]; // little-endian
+    uint8_t last_x;
+    uint8_t last_y;
+    uint8_t current_player; // X or O
+    uint8_t reserved; // always 0
+} GameEncodingHeader;
+
+/**
+ * Return the number of bytes of an encoded position. All positions of one board size have the same size, so an array
+ * of them can be indexed directly.
+ * @param board_size Size of the board along one axis.
+ * @return Size of the position in bytes.
+ */
+size_t game_encoded_size(uint8_t board_size);
+
+/**
+ * Encode a position into a buffer. The Zobrist hash isn't stored, it's recomputed when decoding.
+ * @param game Position to encode.
+ * @param buffer Buffer to write to, must have space for game_encoded_size bytes.
+ * @return Number of bytes written.
+ */
+size_t game_encode(const Game* game, uint8_t* buffer);
+
+/**
+ * Check that an encoded position can occur in a game. The version must be current, no tile can be marked by both
+ * players or lie past the last tile, the marks must add up to the number of turns with X having the same number of
+ * marks as O (X to move) or one more (O to move), and the last move must hold a mark of the player who isn't to move
+ * (unless it's (0, 0), which game_un_move uses when the real last move isn't known).
+ * @param buffer Encoded position.
+ * @return True if the position is valid.
+ */
+bool game_encoding_verify(const uint8_t* buffer);
+
+/**
+ * Decode a position into an existing game without allocating memory. Buffers with a different version or board size,
+ * or that don't pass game_encoding_verify, are rejected.
+ * @param target Game to overwrite. Must have the same board size as the encoded position.
+ * @param buffer Encoded position, written by game_encode.
+ */
+void game_decode(Game* target, const uint8_t* buffer);
+
+/**
+ * Encode an array of positions into consecutive records of one buffer.
+ * @param games Positions to encode, all of them must have the same board size.
+ * @param count Number of positions.
+ * @param buffer Buffer to write to, must have space for count * game_encoded_size bytes.
+ * @return Number of bytes written.
+ */
+size_t game_encode_batch(const Game* const* games, size_t count, uint8_t* buffer);
+
+/**
+ * Decode consecutive records of a buffer into an array of existing games.
+ * @param targets Games to overwrite, all of them must have the board size of the encoded positions.
+ * @param count Number of positions.
+ * @param buffer Encoded positions, written by game_encode_batch.
+ */
+void game_decode_batch(Game* const* targets, size_t count, const uint8_t* buffer);
+
+#endif //GAME_ENCODING_H
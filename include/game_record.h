@@ -0,0 +1,154 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef GAME_RECORD_H
+#define GAME_RECORD_H
+
+#include <stdio.h>
+
+#include "game.h"
+
+// format version written into the file header, files with a different version are rejected
+#define GAME_RECORD_VERSION 1
+// the writer collects records in a buffer of at least this many bytes before writing them to the file
+#define GAME_RECORD_BUFFER_SIZE (1 << 16)
+
+// file header, followed by the records
+typedef struct
+{
+    char magic[8]; // "OXOXLOG" padded with zeros
+    uint32_t version;
+    uint8_t board_size; // all games of a log have the same board size
+    uint8_t reserved[3];
+} GameRecordFileHeader;
+
+/**
+ * Header of one record, followed by the tiles of the moves in the order they were played. A tile takes 1 byte on
+ * boards with at most 256 tiles and 2 bytes (little-endian) on larger ones. All the fields are bytes, so the format
+ * doesn't depend on the byte order of the machine.
+ */
+typedef struct
+{
+    uint8_t num_moves[2]; // little-endian
+    int8_t result; // 1 if X won, -1 if O won, 0 for draw
+    uint8_t reserved; // always 0
+    uint8_t checksum[4]; // little-endian FNV-1a of the number of moves, the result and the tiles
+} GameRecordHeader;
+
+/**
+ * One game of a log, read without copying. The tiles point into the memory of the reader and stay valid until the
+ * reader is closed.
+ */
+typedef struct
+{
+    const uint8_t* tiles; // encoded tiles, read them with game_record_tile
+    uint16_t num_moves;
+    int8_t result; // 1 if X won, -1 if O won, 0 for draw
+    uint8_t board_size; // board size of the log the record comes from
+    uint32_t checksum; // checksum stored in the record
+} GameRecord;
+
+/**
+ * Writer that appends games to a log. The records are collected in a buffer and written in large blocks.
+ */
+typedef struct
+{
+    FILE* file;
+    uint8_t* buffer;
+    size_t buffer_used;
+    size_t buffer_capacity;
+    BitSet* seen_tiles; // tiles of the record being validated
+    uint8_t board_size;
+} GameRecordWriter;
+
+/**
+ * Read-only log, memory-mapped from a file and iterated record by record.
+ */
+typedef struct
+{
+    void* mapping; // start of the mapped file
+    size_t mapped_size;
+    const uint8_t* cursor; // start of the next record
+    const uint8_t* end; // end of the file
+    bool truncated; // the file ends inside a record (e.g. the writer crashed), the iteration stopped before it
+    uint8_t board_size;
+} GameRecordReader;
+
+/**
+ * Open a log for appending, creating it if it doesn't exist. A record cut off at the end of an existing log (e.g. by a
+ * crash during writing) is removed, so the new records stay readable.
+ * @param path Path of the log.
+ * @param board_size Size of the board along one axis, must match the log if it already exists.
+ * @return Pointer to the writer.
+ */
+GameRecordWriter* game_record_writer_open(const char* path, uint8_t board_size);
+
+/**
+ * Append a game to the log. The moves are validated (on the board and each tile played once), so they can be replayed
+ * without checks.
+ * @param writer Writer to append with.
+ * @param tiles Tiles of the moves (y * board_size + x) in the order they were played.
+ * @param num_moves Number of moves.
+ * @param result 1 if X won, -1 if O won, 0 for draw.
+ */
+void game_record_write(GameRecordWriter* writer, const uint16_t* tiles, uint16_t num_moves, int8_t result);
+
+/**
+ * Write the buffered records to the file.
+ * @param writer Writer to flush.
+ */
+void game_record_writer_flush(GameRecordWriter* writer);
+
+/**
+ * Flush the buffered records, close the file and free the writer.
+ * @param writer Pointer to the writer.
+ */
+void game_record_writer_close(GameRecordWriter* writer);
+
+/**
+ * Memory-map a log. The records aren't parsed or copied, the pages are loaded by the OS as the iteration reaches them.
+ * @param path Path of a file created by game_record_writer_open.
+ * @return Pointer to the reader, positioned at the first record.
+ */
+GameRecordReader* game_record_reader_open(const char* path);
+
+/**
+ * Read the next record of a log.
+ * @param reader Reader to advance.
+ * @param record Record to fill in, its tiles point into the mapped file.
+ * @return True if a record was read, false at the end of the log.
+ */
+bool game_record_next(GameRecordReader* reader, GameRecord* record);
+
+/**
+ * Unmap a log and free the reader.
+ * @param reader Pointer to the reader.
+ */
+void game_record_reader_close(GameRecordReader* reader);
+
+/**
+ * Return the tile of a move of a record.
+ * @param record Record to read.
+ * @param index Index of the move, must be less than the number of moves.
+ * @return Tile of the move (y * board_size + x).
+ */
+uint16_t game_record_tile(const GameRecord* record, uint16_t index);
+
+/**
+ * Check that a record matches its checksum.
+ * @param record Record to check.
+ * @return True if the record is intact.
+ */
+bool game_record_verify(const GameRecord* record);
+
+/**
+ * Reset a game to the empty board and play the first moves of a record. The checksum is verified once and the moves
+ * are then played without checking them, since the writer already did.
+ * @param game Game to overwrite, must have the board size of the log.
+ * @param record Record to replay.
+ * @param num_moves Number of moves to play, at most the number of moves of the record.
+ */
+void game_record_replay(Game* game, const GameRecord* record, uint16_t num_moves);
+
+#endif //GAME_RECORD_H
@@ -0,0 +1,132 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef MCTS_H
+#define MCTS_H
+
+#include <stdatomic.h>
+
+#include "game.h"
+#include "rng.h"
+
+/**
+ * Monte Carlo Tree Search over one board size. Nodes live in a pool that is reused between searches and are addressed
+ * by index, the children of a node are stored next to each other and the node statistics are kept in separate arrays
+ * (structure of arrays), so the selection loop only touches the data it needs.
+ */
+typedef struct
+{
+    // node pool, node 0 is the root of the current search
+    uint32_t* first_child; // index of the first child, 0 if the node wasn't expanded yet
+    uint16_t* num_children; // number of children (all legal moves of the node's position)
+    uint16_t* move; // tile index (y * board_size + x) of the move that leads to the node
+    uint32_t* visits; // number of simulations that went through the node
+    float* value_sum; // sum of simulation results from the perspective of the player who made the node's move
+    uint32_t num_nodes; // number of nodes in use
+    uint32_t capacity; // maximum number of nodes
+
+    // scratch memory for the iterations
+    Game* game; // position the iterations descend in
+    uint8_t (*move_buffer)[2]; // legal moves for the random plays
+    uint16_t* tile_buffer; // legal moves for expanding nodes
+    uint32_t* path; // nodes visited by the current iteration
+    Rng rng; // generator for the random plays
+} Mcts;
+
+typedef struct MctsWorker MctsWorker;
+
+/**
+ * Monte Carlo Tree Search where multiple threads descend one shared tree. The node statistics are atomic, a virtual
+ * loss on the path of every running iteration steers the other threads to different moves, and children are allocated
+ * from the pool with an atomic bump of the node count (no locks anywhere). Every thread plays on its own game copy.
+ */
+typedef struct
+{
+    // node pool, node 0 is the root of the current search
+    _Atomic uint32_t* first_child; // index of the first child, 0 if not expanded, MCTS_EXPANDING while being expanded
+    uint16_t* num_children; // written before first_child is published
+    uint16_t* move; // tile index (y * board_size + x) of the move that leads to the node
+    _Atomic uint32_t* visits; // number of simulations through the node (including the running ones)
+    _Atomic int32_t* value_sum; // sum of results for the player who made the node's move (results are -1, 0 or 1)
+    _Atomic uint32_t num_nodes; // number of nodes in use
+    uint32_t capacity; // maximum number of nodes
+
+    uint8_t board_size;
+    unsigned int num_threads;
+    MctsWorker* workers; // per-thread scratch memory
+} ParallelMcts;
+
+// marks a node whose children are being created by another thread (or that can't get children because the pool is full)
+#define MCTS_EXPANDING UINT32_MAX
+
+typedef struct
+{
+    unsigned int max_iterations; // stop after this many iterations, 0 for no limit
+    double max_seconds; // stop after this much wall-clock time, 0 for no limit
+    float exploration; // UCT exploration constant (e.g. 1.41)
+} MctsConfig;
+
+typedef struct
+{
+    uint8_t x; // X coordinate of the best move
+    uint8_t y; // Y coordinate of the best move
+    float value; // average result of the best move from the perspective of the player to move (-1 to 1)
+    uint32_t visits; // number of simulations through the best move
+    unsigned int iterations; // number of iterations the search performed
+    uint32_t num_nodes; // number of nodes the tree used
+} MctsResult;
+
+/**
+ * Allocate a search with a fixed node pool.
+ * @param board_size Size of the board along one axis, all searched positions must have this size.
+ * @param capacity Maximum number of nodes in the tree. When the pool is full, the tree stops growing but the search
+ *                 continues with simulations from the existing leaves.
+ * @param seed Seed for the random plays.
+ * @return Pointer to the search.
+ */
+Mcts* mcts_create(uint8_t board_size, uint32_t capacity, uint64_t seed);
+
+/**
+ * Free the memory allocated for the search.
+ * @param mcts Pointer to the search.
+ */
+void mcts_free(Mcts* mcts);
+
+/**
+ * Search a position and return the most visited move. The tree is rebuilt from scratch for every call. At least one
+ * of the budgets has to be set.
+ * @param mcts Search to use.
+ * @param position Position to search. It must have at least one legal move and must not be won already.
+ * @param config Budget and parameters of the search.
+ * @return The best move and the search statistics.
+ */
+MctsResult mcts_search(Mcts* mcts, const Game* position, const MctsConfig* config);
+
+/**
+ * Allocate a tree-parallel search with a fixed node pool.
+ * @param board_size Size of the board along one axis, all searched positions must have this size.
+ * @param capacity Maximum number of nodes in the tree.
+ * @param num_threads Number of threads that search the tree (including the calling thread).
+ * @param seed Seed for the random plays, every thread gets its own stream split from it.
+ * @return Pointer to the search.
+ */
+ParallelMcts* parallel_mcts_create(uint8_t board_size, uint32_t capacity, unsigned int num_threads, uint64_t seed);
+
+/**
+ * Free the memory allocated for the search.
+ * @param mcts Pointer to the search.
+ */
+void parallel_mcts_free(ParallelMcts* mcts);
+
+/**
+ * Search a position with all the threads and return the most visited move. Same contract as mcts_search, the
+ * iteration budget is shared by all the threads. Because the threads interleave, results aren't reproducible.
+ * @param mcts Search to use.
+ * @param position Position to search. It must have at least one legal move and must not be won already.
+ * @param config Budget and parameters of the search.
+ * @return The best move and the search statistics.
+ */
+MctsResult parallel_mcts_search(ParallelMcts* mcts, const Game* position, const MctsConfig* config);
+
+#endif //MCTS_H
@@ -0,0 +1,383 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef OXOX_HPP
+#define OXOX_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+extern "C" {
+#include "bitboard.h"
+#include "game.h"
+}
+
+namespace oxox {
+
+namespace detail {
+
+/**
+ * Lookup tables of one board size, computed at compile time.
+ */
+template <uint8_t N>
+struct Tables
+{
+    static constexpr uint16_t num_tiles = N * N;
+    static constexpr size_t num_words = (num_tiles + 63) / 64;
+    // a tile is in at most 3 lines per direction
+    static constexpr uint8_t max_lines = 3 * NUM_LINE_DIRECTIONS;
+
+    // lines of 3 tiles through every tile, the middle tile of a line is at index 1
+    std::array<std::array<std::array<uint16_t, 3>, max_lines>, num_tiles> lines{};
+    std::array<uint8_t, num_tiles> line_counts{};
+    // tiles where a pattern in a direction can start without wrapping around the board edge (indexed by LineDirection)
+    std::array<std::array<uint64_t, num_words>, NUM_LINE_DIRECTIONS> edge_masks{};
+    // index difference between neighbouring tiles of a pattern in every direction
+    std::array<uint16_t, NUM_LINE_DIRECTIONS> steps{1, N, N + 1, N - 1};
+};
+
+template <uint8_t N>
+constexpr Tables<N> make_tables() {
+    Tables<N> tables;
+    // outward step of every direction, in the order of LineDirection
+    constexpr int directions[NUM_LINE_DIRECTIONS][2] = {{1, 0}, {0, 1}, {1, 1}, {-1, 1}};
+
+    for (int y = 0; y < N; y++) {
+        for (int x = 0; x < N; x++) {
+            const uint16_t tile = y * N + x;
+
+            for (int d = 0; d < NUM_LINE_DIRECTIONS; d++) {
+                const int dx = directions[d][0];
+                const int dy = directions[d][1];
+
+                // the tile can be the first, the middle or the last tile of a line
+                for (int position = 0; position < 3; position++) {
+                    const int start_x = x - position * dx;
+                    const int start_y = y - position * dy;
+                    const int end_x = start_x + 2 * dx;
+                    const int end_y = start_y + 2 * dy;
+                    if (start_x < 0 || start_x >= N || start_y < 0 || end_x < 0 || end_x >= N || end_y >= N) {
+                        continue;
+                    }
+
+                    const uint16_t start = start_y * N + start_x;
+                    const uint16_t step = dy * N + dx;
+                    tables.lines[tile][tables.line_counts[tile]++] = {start, static_cast<uint16_t>(start + step),
+                                                                      static_cast<uint16_t>(start + 2 * step)};
+
+                    if (position == 0) {
+                        tables.edge_masks[d][tile / 64] |= uint64_t{1} << tile % 64;
+                    }
+                }
+            }
+        }
+    }
+
+    return tables;
+}
+
+template <uint8_t N>
+inline constexpr Tables<N> tables = make_tables<N>();
+
+} // namespace detail
+
+/**
+ * OXOX game with the board size fixed at compile time. The marks of both players are stored inline as fixed-width
+ * bitboards, and the index math, the win lines and the edge masks are constants, so the compiler can fully unroll
+ * and specialize the move, win check and random play code for the size. Tile (x, y) maps to bit y * N + x, same as
+ * in the C Board, so converting from and to the C Game is a plain copy of the words.
+ * @tparam N Size of the board along one axis.
+ */
+template <uint8_t N>
+struct Game
+{
+    static_assert(N >= 1, "Board size cannot be 0.");
+
+    static constexpr uint16_t num_tiles = N * N;
+    static constexpr size_t num_words = (num_tiles + 63) / 64;
+    using Words = std::array<uint64_t, num_words>;
+
+    Words player_one_board{}; // tiles marked by X, the bits past the last tile are always 0
+    Words player_two_board{}; // tiles marked by O
+    uint16_t turns_taken = 0; // number of turns that already occurred
+    uint8_t last_x = 0; // X coordinate of the last move
+    uint8_t last_y = 0; // Y coordinate of the last move
+    PlayerMark current_player = X;
+
+    bool operator==(const Game&) const = default;
+
+    /**
+     * Return which player occupies a tile or if it's empty.
+     * @param tile Index of the tile (y * N + x).
+     * @return What mark is on the tile.
+     */
+    constexpr PlayerMark get(const uint16_t tile) const {
+        const uint64_t one = player_one_board[tile / 64] >> tile % 64 & 1;
+        const uint64_t two = player_two_board[tile / 64] >> tile % 64 & 1;
+        return static_cast<PlayerMark>(one | two << 1);
+    }
+
+    /**
+     * Return which player occupies a tile or if it's empty.
+     * @param x X coordinate of the tile.
+     * @param y Y coordinate of the tile.
+     * @return What mark is on the tile.
+     */
+    constexpr PlayerMark get(const uint8_t x, const uint8_t y) const {
+        return get(y * N + x);
+    }
+
+    /**
+     * Place the current player's mark on an empty tile and pass the turn. The tile isn't checked, like in
+     * game_move_unchecked.
+     * @param tile Index of an empty tile.
+     */
+    constexpr void move(const uint16_t tile) {
+        Words& board = current_player == X ? player_one_board : player_two_board;
+        board[tile / 64] |= uint64_t{1} << tile % 64;
+        turns_taken++;
+        last_x = tile % N;
+        last_y = tile / N;
+        current_player = current_player == X ? O : X;
+    }
+
+    /**
+     * Place the current player's mark on an empty tile and pass the turn.
+     * @param x X coordinate of an empty tile.
+     * @param y Y coordinate of an empty tile.
+     */
+    constexpr void move(const uint8_t x, const uint8_t y) {
+        move(y * N + x);
+    }
+
+    /**
+     * Take back the last move. The last move coordinates are reset to (0, 0), like in game_un_move without a history.
+     * @param tile Index of the tile of the last move.
+     */
+    constexpr void un_move(const uint16_t tile) {
+        current_player = current_player == X ? O : X;
+        Words& board = current_player == X ? player_one_board : player_two_board;
+        board[tile / 64] &= ~(uint64_t{1} << tile % 64);
+        turns_taken--;
+        last_x = 0;
+        last_y = 0;
+    }
+
+    /**
+     * Check if the last move completed an XOX or OXO pattern.
+     * @return True if the player who made the last move won.
+     */
+    constexpr bool is_win() const {
+        const auto& table = detail::tables<N>;
+        const uint16_t tile = last_y * N + last_x;
+
+        for (uint8_t i = 0; i < table.line_counts[tile]; i++) {
+            const auto& line = table.lines[tile][i];
+            const PlayerMark first = get(line[0]);
+            const PlayerMark middle = get(line[1]);
+
+            if (first != EMPTY && middle != EMPTY && middle != first && get(line[2]) == first) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Check if there's any XOX or OXO pattern on the board, regardless of the last move.
+     * @return True if the position is winning.
+     */
+    constexpr bool is_win_full() const {
+        const auto& table = detail::tables<N>;
+        uint64_t found = 0;
+
+        for (uint8_t direction = 0; direction < NUM_LINE_DIRECTIONS; direction++) {
+            const uint16_t step = table.steps[direction];
+            const Words o_once = shift_down(player_two_board, step);
+            const Words x_once = shift_down(player_one_board, step);
+            const Words x_twice = shift_down(player_one_board, 2 * step);
+            const Words o_twice = shift_down(player_two_board, 2 * step);
+
+            for (size_t i = 0; i < num_words; i++) {
+                const uint64_t xox = player_one_board[i] & o_once[i] & x_twice[i];
+                const uint64_t oxo = player_two_board[i] & x_once[i] & o_twice[i];
+                found |= (xox | oxo) & table.edge_masks[direction][i];
+            }
+        }
+
+        return found != 0;
+    }
+
+    /**
+     * Check if the board is full.
+     * @return True if no tile is empty.
+     */
+    constexpr bool is_tie() const {
+        return turns_taken == num_tiles;
+    }
+
+    /**
+     * Write the indices of all the empty tiles into a buffer, in increasing order.
+     * @param tile_buffer Buffer to write the tiles to.
+     * @return Number of empty tiles.
+     */
+    constexpr uint16_t get_legal_tiles(std::array<uint16_t, num_tiles>& tile_buffer) const {
+        uint16_t count = 0;
+
+        for (size_t i = 0; i < num_words; i++) {
+            uint64_t empty = ~(player_one_board[i] | player_two_board[i]);
+            if (i == num_words - 1 && num_tiles % 64 != 0) {
+                empty &= (uint64_t{1} << num_tiles % 64) - 1;
+            }
+
+            while (empty != 0) {
+                tile_buffer[count++] = i * 64 + std::countr_zero(empty);
+                empty &= empty - 1; // clear the lowest set bit
+            }
+        }
+
+        return count;
+    }
+
+    /**
+     * Play uniformly random moves until a win or a draw, like game_random_play_rng.
+     * @param rng Generator to draw the moves with.
+     * @return 1 if the starting player won, -1 if they lost, 0 for draw.
+     */
+    float random_play(Rng& rng) {
+        std::array<uint16_t, num_tiles> tiles;
+        const uint16_t num_moves = get_legal_tiles(tiles);
+        const PlayerMark starting_player = current_player;
+
+        for (uint16_t i = 0; i < num_moves; i++) {
+            if (is_last_move_win()) {
+                // who's turn it is now lost during the last turn
+                return current_player == starting_player ? -1 : 1;
+            }
+
+            // one step of the Fisher-Yates shuffle, the moves are drawn lazily
+            std::swap(tiles[i], tiles[i + rng_below(&rng, num_moves - i)]);
+            move(tiles[i]);
+        }
+
+        // the move that filled the board could have completed a pattern as well
+        if (is_last_move_win()) {
+            return current_player == starting_player ? -1 : 1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Estimate the position with random plays, like game_rollout_rng. The game itself isn't modified.
+     * @param num_iterations Number of random plays to average.
+     * @param rng Generator to draw the moves with.
+     * @return Average result from the perspective of the player to move (-1 to 1).
+     */
+    float rollout(const unsigned int num_iterations, Rng& rng) const {
+        float score_sum = 0;
+
+        for (unsigned int i = 0; i < num_iterations; i++) {
+            Game copy = *this;
+            score_sum += copy.random_play(rng);
+        }
+
+        return score_sum / static_cast<float>(num_iterations);
+    }
+
+    /**
+     * Convert a C game of the same size.
+     * @param game Game to read from.
+     * @return The same position.
+     */
+    static Game from_c(const ::Game* game) {
+        if (game == nullptr || game->board->board_size != N) {
+            throw std::invalid_argument("oxox::Game::from_c: the C game must have the same board size.");
+        }
+
+        Game result;
+        for (size_t i = 0; i < num_words; i++) {
+            result.player_one_board[i] = game->board->player_one_board->bits[i];
+            result.player_two_board[i] = game->board->player_two_board->bits[i];
+        }
+        result.turns_taken = game->turns_taken;
+        result.last_x = game->last_x;
+        result.last_y = game->last_y;
+        result.current_player = game->current_player;
+        return result;
+    }
+
+    /**
+     * Write the position into a C game of the same size, without allocating memory. The Zobrist hash is recomputed and
+     * the history of the C game (if enabled) is emptied.
+     * @param target Game to overwrite.
+     */
+    void copy_into_c(::Game* target) const {
+        if (target == nullptr || target->board->board_size != N) {
+            throw std::invalid_argument("oxox::Game::copy_into_c: the C game must have the same board size.");
+        }
+
+        for (size_t i = 0; i < num_words; i++) {
+            target->board->player_one_board->bits[i] = player_one_board[i];
+            target->board->player_two_board->bits[i] = player_two_board[i];
+        }
+        target->turns_taken = turns_taken;
+        target->last_x = last_x;
+        target->last_y = last_y;
+        target->current_player = current_player;
+        target->hash = game_compute_hash(target);
+        target->history_length = 0;
+    }
+
+    /**
+     * Allocate a C game with the same position.
+     * @return Pointer to the game, free it with game_free.
+     */
+    ::Game* to_c() const {
+        ::Game* game = game_create(N);
+        copy_into_c(game);
+        return game;
+    }
+
+private:
+    /**
+     * Check if the last move won with the faster of the two checks. A board in a single word is checked whole with a
+     * few word operations, larger ones only along the lines through the last move.
+     */
+    constexpr bool is_last_move_win() const {
+        if constexpr (num_words == 1) {
+            return is_win_full();
+        }
+        else {
+            return is_win();
+        }
+    }
+
+    /**
+     * Shift a bitboard towards lower indices, so that bit i of the output holds bit i + shift of the input.
+     */
+    static constexpr Words shift_down(const Words& words, const size_t shift) {
+        Words output{};
+        const size_t word_shift = shift / 64;
+        const size_t bit_shift = shift % 64;
+
+        for (size_t i = 0; i + word_shift < num_words; i++) {
+            output[i] = words[i + word_shift] >> bit_shift;
+            if (bit_shift != 0 && i + word_shift + 1 < num_words) {
+                output[i] |= words[i + word_shift + 1] << (64 - bit_shift);
+            }
+        }
+
+        return output;
+    }
+};
+
+} // namespace oxox
+
+#endif //OXOX_HPP
@@ -0,0 +1,50 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef PLAYOUT_BATCH_H
+#define PLAYOUT_BATCH_H
+
+#include <stdalign.h>
+
+#include "game.h"
+
+// number of games a batch plays at once
+#define PLAYOUT_BATCH_LANES 16
+// largest board (along one axis) a batch supports, every lane's board has to fit into one 64-bit word
+#define PLAYOUT_BATCH_MAX_SIZE 8
+
+/**
+ * Independent random games that advance in lock-step, one move per lane per step. The boards are stored as structure
+ * of arrays (one word per lane and player), so the pattern search runs over several lanes at once with SIMD
+ * instructions. Since all the lanes start from the same position, the same player is to move in all of them.
+ */
+typedef struct
+{
+    alignas(32) uint64_t player_one_board[PLAYOUT_BATCH_LANES];
+    alignas(32) uint64_t player_two_board[PLAYOUT_BATCH_LANES];
+    alignas(32) uint64_t patterns[PLAYOUT_BATCH_LANES]; // pattern starts found by the last step (any direction)
+    int8_t results[PLAYOUT_BATCH_LANES]; // result of each game from the perspective of the starting player
+} PlayoutBatch;
+
+/**
+ * Play random games from a position in all the lanes of a batch until every one of them is decided. The moves are
+ * uniform over the empty tiles, like in game_random_play, and finished lanes are masked out of the following steps.
+ * @param batch Batch to play in, its previous content is overwritten.
+ * @param position Starting position, the board size must be at most PLAYOUT_BATCH_MAX_SIZE.
+ * @param num_lanes Number of games to play (1 to PLAYOUT_BATCH_LANES).
+ * @param rng Generator to draw the moves with.
+ * @return Sum of the results of the games (1 if the starting player won, -1 if they lost, 0 for draw).
+ */
+int playout_batch_run(PlayoutBatch* batch, const Game* position, uint8_t num_lanes, Rng* rng);
+
+/**
+ * Same as game_rollout_rng, but the random plays run in batches of PLAYOUT_BATCH_LANES games.
+ * @param position Position to estimate, the board size must be at most PLAYOUT_BATCH_MAX_SIZE.
+ * @param num_iterations Number of random plays to average.
+ * @param rng Generator to draw the moves with.
+ * @return Average result from the perspective of the player to move (-1 to 1).
+ */
+float game_rollout_batch(const Game* position, unsigned int num_iterations, Rng* rng);
+
+#endif //PLAYOUT_BATCH_H
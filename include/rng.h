@@ -0,0 +1,56 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * State of a xoshiro256** pseudo-random generator. Every user (e.g. a thread) owns its generator, so there's no shared
+ * state like with rand(), and a play can be reproduced by seeding the generator the same way.
+ */
+typedef struct
+{
+    uint64_t state[4];
+} Rng;
+
+/**
+ * Initialize a generator from a seed. Equal seeds produce equal sequences.
+ * @param rng Generator to initialize.
+ * @param seed Any 64-bit value (the state is expanded from it with splitmix64, so 0 is fine too).
+ */
+void rng_seed(Rng* rng, uint64_t seed);
+
+/**
+ * Return the next 64 random bits.
+ * @param rng Generator to advance.
+ * @return Uniformly distributed 64-bit number.
+ */
+uint64_t rng_next(Rng* rng);
+
+/**
+ * Return a uniformly distributed number from 0 to bound - 1. Uses multiply-shift range reduction with rejection, so
+ * there's no modulo bias and usually no division.
+ * @param rng Generator to advance.
+ * @param bound Number of possible values, must be larger than 0.
+ * @return Number in the range [0, bound).
+ */
+uint32_t rng_below(Rng* rng, uint32_t bound);
+
+/**
+ * Advance the generator by 2^128 steps, equivalent to that many rng_next calls.
+ * @param rng Generator to advance.
+ */
+void rng_jump(Rng* rng);
+
+/**
+ * Split off an independent stream. The returned generator continues the current sequence and the original jumps
+ * 2^128 steps ahead, so the two streams never overlap in practice.
+ * @param rng Generator to split, it's advanced in the process.
+ * @return New generator for the split-off stream.
+ */
+Rng rng_split(Rng* rng);
+
+#endif //RNG_H
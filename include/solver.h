@@ -0,0 +1,96 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "game.h"
+
+// deepest search the solver supports, a depth of 0 in game_solve means "up to this many plies"
+#define SOLVER_MAX_DEPTH 254
+
+// bound stored in a transposition table entry
+typedef enum
+{
+    BOUND_EXACT = 0, // score is the exact value of the position
+    BOUND_LOWER = 1, // position is worth at least the score (the search failed high)
+    BOUND_UPPER = 2, // position is worth at most the score (the search failed low)
+} BoundType;
+
+typedef struct
+{
+    uint64_t key; // full Zobrist hash of the position, to detect index collisions
+    int16_t score; // score from the perspective of the player to move, win distances are relative to the position
+    uint16_t best_move; // tile index of the best move found, UINT16_MAX if none
+    uint8_t depth; // remaining depth of the search that produced the entry, 255 if it's exact at any depth
+    uint8_t bound; // BoundType of the score
+    uint8_t generation; // game_solve call that wrote the entry, old entries are replaced first
+} TranspositionEntry;
+
+/**
+ * Fixed-size hash table of searched positions, indexed by the low bits of the position hash. When two positions
+ * collide, the entry from a deeper search is kept, unless the stored one comes from an earlier solve.
+ */
+typedef struct
+{
+    TranspositionEntry* entries;
+    uint64_t mask; // number of entries - 1 (the number of entries is a power of 2)
+    uint8_t generation; // incremented by every solve that uses the table
+} TranspositionTable;
+
+typedef struct
+{
+    uint8_t x; // X coordinate of the best move
+    uint8_t y; // Y coordinate of the best move
+    int8_t value; // 1 if the player to move wins, -1 if they lose, 0 for a draw or an unknown result
+    bool solved; // true if the value is proven, false if the search ran out of depth or time
+    uint8_t plies_to_end; // for a proven win or loss, number of plies until the game ends with best play
+    uint8_t depth; // depth of the last completed iteration
+    uint64_t nodes; // number of positions visited
+} SolveResult;
+
+/**
+ * Allocate an empty transposition table.
+ * @param log2_entries Base-2 logarithm of the number of entries (each entry takes 16 bytes, e.g. 20 -> 16 MiB).
+ * @return Pointer to the table.
+ */
+TranspositionTable* transposition_table_create(uint8_t log2_entries);
+
+/**
+ * Remove all entries from a transposition table.
+ * @param table Table to clear.
+ */
+void transposition_table_clear(TranspositionTable* table);
+
+/**
+ * Free the memory allocated for a transposition table.
+ * @param table Pointer to the table.
+ */
+void transposition_table_free(TranspositionTable* table);
+
+/**
+ * Search a position exactly with negamax and alpha-beta pruning, deepening one ply at a time until the result is
+ * proven or a budget runs out. Moves are made and reverted in place with game_move and game_un_move, and are ordered
+ * by the transposition table move first and a history heuristic after it. Wins in fewer plies are preferred. A
+ * temporary transposition table is allocated for the call, use game_solve_with_table to keep one between calls.
+ * @param game Position to solve. It must have at least one legal move and must not be won already. It's modified
+ *             during the search, but restored before returning.
+ * @param max_depth Maximum number of plies to search, 0 for SOLVER_MAX_DEPTH.
+ * @param time_budget Maximum wall-clock time in seconds, 0 for no limit. The first iteration always completes.
+ * @return The best move and the value of the position.
+ */
+SolveResult game_solve(Game* game, uint8_t max_depth, double time_budget);
+
+/**
+ * Same as game_solve, but with a caller-owned transposition table. Entries from earlier calls stay usable, so
+ * consecutive positions of one game are solved faster.
+ * @param game Position to solve.
+ * @param max_depth Maximum number of plies to search, 0 for SOLVER_MAX_DEPTH.
+ * @param time_budget Maximum wall-clock time in seconds, 0 for no limit.
+ * @param table Transposition table to use.
+ * @return The best move and the value of the position.
+ */
+SolveResult game_solve_with_table(Game* game, uint8_t max_depth, double time_budget, TranspositionTable* table);
+
+#endif //SOLVER_H
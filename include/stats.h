@@ -0,0 +1,41 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+
+/**
+ * Counters of the hot paths. They're only collected when the library is built with the OXOX_STATS option (CMake
+ * -DOXOX_STATS=ON), otherwise the counting compiles to nothing and every counter stays 0.
+ */
+typedef struct
+{
+    uint64_t bitset_allocations; // bitsets allocated by bitset_create and bitset_clone
+    uint64_t board_allocations; // boards allocated by board_create and board_clone
+    uint64_t game_allocations; // games allocated by game_create and game_clone (not the ones in an arena)
+    uint64_t win_checks; // calls to game_is_win and game_is_win_full
+    uint64_t board_gets; // calls to board_get (board_get_unchecked isn't counted)
+    uint64_t moves; // calls to game_move (game_move_unchecked isn't counted)
+    uint64_t playouts; // finished random plays (one-by-one and batched)
+    uint64_t playout_moves; // moves made by the random plays, divide by playouts for the average length
+    uint64_t playout_wins; // random plays won by the player who started them
+    uint64_t playout_draws;
+    uint64_t playout_losses;
+} OxoxStats;
+
+/**
+ * Return the sum of the counters over all the threads, including the ones that already exited. Every thread counts
+ * into its own block without any synchronization, so the snapshot can miss the last few events of running threads.
+ * @return The counters.
+ */
+OxoxStats oxox_stats_snapshot(void);
+
+/**
+ * Set all the counters of all the threads to 0.
+ */
+void oxox_stats_reset(void);
+
+#endif //STATS_H
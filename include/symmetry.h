@@ -0,0 +1,79 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include "bitboard.h"
+
+// symmetries of a square board (the dihedral group of order 8), the coordinates are (x, y) with y pointing down
+typedef enum
+{
+    SYMMETRY_IDENTITY = 0, // (x, y)
+    SYMMETRY_ROTATE_90 = 1, // clockwise, (n - y, x) where n = board_size - 1
+    SYMMETRY_ROTATE_180 = 2, // (n - x, n - y)
+    SYMMETRY_ROTATE_270 = 3, // clockwise, (y, n - x)
+    SYMMETRY_FLIP_HORIZONTAL = 4, // mirror the columns, (n - x, y)
+    SYMMETRY_FLIP_VERTICAL = 5, // mirror the rows, (x, n - y)
+    SYMMETRY_TRANSPOSE = 6, // mirror along the main diagonal, (y, x)
+    SYMMETRY_ANTI_TRANSPOSE = 7, // mirror along the anti-diagonal, (n - y, n - x)
+} BoardSymmetry;
+
+#define NUM_SYMMETRIES 8
+
+/**
+ * Map a tile to where a symmetry moves it. Works for any board size.
+ * @param board_size Size of the board along one axis.
+ * @param tile Index of the tile (y * board_size + x).
+ * @param symmetry Symmetry to apply.
+ * @return Index of the transformed tile.
+ */
+uint16_t symmetry_transform_tile(uint8_t board_size, uint16_t tile, BoardSymmetry symmetry);
+
+/**
+ * Return the symmetry that undoes another one.
+ * @param symmetry Symmetry to invert.
+ * @return The inverse symmetry.
+ */
+BoardSymmetry symmetry_inverse(BoardSymmetry symmetry);
+
+/**
+ * Apply a symmetry to a whole position. Only the marked tiles are visited, each one with a table lookup, so the
+ * near-empty positions of the opening are the cheapest to transform.
+ * @param bitboard Position to transform.
+ * @param symmetry Symmetry to apply.
+ * @return The transformed position (by value).
+ */
+BitBoard bitboard_transform(const BitBoard* bitboard, BoardSymmetry symmetry);
+
+/**
+ * Find the canonical representative of a position: the smallest of its 8 transforms, comparing the words of X from the
+ * last one down and then the words of O the same way. All symmetric positions have the same representative, so it can
+ * be used as a cache key.
+ * @param bitboard Position to canonicalize.
+ * @param canonical Output for the representative.
+ * @return Symmetry that transforms the position into the representative.
+ */
+BoardSymmetry bitboard_canonicalize(const BitBoard* bitboard, BitBoard* canonical);
+
+/**
+ * Same as bitboard_canonicalize, for a heap-allocated board.
+ * @param board Position to canonicalize, its size must be at most BITBOARD_MAX_SIZE.
+ * @param canonical Pre-allocated board of the same size, overwritten with the representative.
+ * @return Symmetry that transforms the position into the representative.
+ */
+BoardSymmetry board_canonicalize(const Board* board, const Board* canonical);
+
+/**
+ * Write the empty tiles into a buffer, but only one tile per class of moves that lead to symmetric positions. Only the
+ * symmetries that leave the position unchanged can make two moves equivalent, so on an empty board up to 8 moves
+ * share a class and on a board without any symmetry every move is its own class. The smallest tile of every class is
+ * kept, in increasing order.
+ * @param tile_buffer Buffer with room for all the empty tiles.
+ * @param board Position to find the moves in, its size must be at most BITBOARD_MAX_SIZE.
+ * @return Number of tiles written.
+ */
+uint16_t board_get_unique_legal_tiles(uint16_t* tile_buffer, const Board* board);
+
+#endif //SYMMETRY_H
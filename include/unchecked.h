@@ -0,0 +1,176 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef UNCHECKED_H
+#define UNCHECKED_H
+
+#include "game.h"
+
+/*
+ * Fast-path variants of the bitset, board and game accessors. They do exactly what their checked counterparts do, but
+ * without validating the arguments, so an invalid index or an illegal move corrupts memory instead of ending the
+ * program with an error. Use them only in loops where the arguments are already known to be valid (e.g. tiles from
+ * board_get_legal_moves). They're not counted by the statistics either.
+ */
+
+// key mixed into the hash when O is to move
+#define GAME_ZOBRIST_SIDE_KEY 0x6A09E667F3BCC908ULL
+
+/**
+ * Scramble a number with the splitmix64 finalizer. It's a bijection, so different inputs give different keys.
+ * @param z Number to scramble.
+ * @return The scrambled number.
+ */
+static inline uint64_t game_zobrist_mix(uint64_t z) {
+    z *= 0x9E3779B97F4A7C15;
+    z = (z ^ z >> 30) * 0xBF58476D1CE4E5B9;
+    z = (z ^ z >> 27) * 0x94D049BB133111EB;
+    return z ^ z >> 31;
+}
+
+/**
+ * Return the Zobrist key of a mark on a tile. The keys are derived with game_zobrist_mix instead of being stored in a
+ * table, so they need no memory or initialization and are the same for every board size.
+ * @param index Index of the tile (y * board_size + x).
+ * @param mark Player on the tile (X or O).
+ * @return The key.
+ */
+static inline uint64_t game_zobrist_key(const uint16_t index, const PlayerMark mark) {
+    return game_zobrist_mix((uint64_t)index * 2 + (mark == O) + 1);
+}
+
+/**
+ * Return the hash of the empty board of a size (with X to move). Every hash starts from it, so positions of different
+ * sizes with the same marked tile indices don't collide. The inputs are above the ones of the tile keys.
+ * @param board_size Size of the board along one axis.
+ * @return The key.
+ */
+static inline uint64_t game_zobrist_board_key(const uint8_t board_size) {
+    return game_zobrist_mix(((uint64_t)1 << 20) + board_size);
+}
+
+/**
+ * Same as bitset_get, without the bounds check.
+ * @param bitset Bitset to read.
+ * @param index Index of the target bit, must be less than the size.
+ * @return True if the bit is 1, false if it is 0.
+ */
+static inline bool bitset_get_unchecked(const BitSet* bitset, const size_t index) {
+    return (bitset->bits[index / 64] >> (index % 64) & 1) != 0;
+}
+
+/**
+ * Same as bitset_set, without the bounds check.
+ * @param bitset Bitset to modify.
+ * @param index Index of the target bit, must be less than the size.
+ */
+static inline void bitset_set_unchecked(const BitSet* bitset, const size_t index) {
+    bitset->bits[index / 64] |= (uint64_t)1 << (index % 64);
+}
+
+/**
+ * Same as bitset_clear, without the bounds check.
+ * @param bitset Bitset to modify.
+ * @param index Index of the target bit, must be less than the size.
+ */
+static inline void bitset_clear_unchecked(const BitSet* bitset, const size_t index) {
+    bitset->bits[index / 64] &= ~((uint64_t)1 << (index % 64));
+}
+
+/**
+ * Same as board_get_index, without the bounds check.
+ * @param board Board to read.
+ * @param index Index of the tile (y * board_size + x), must be on the board.
+ * @return Mark on the tile.
+ */
+static inline PlayerMark board_get_index_unchecked(const Board* board, const uint16_t index) {
+    // X is 1 and O is 2 and a tile never has both bits set, so the bits of both players combine into the mark
+    return (PlayerMark)(bitset_get_unchecked(board->player_one_board, index) |
+                        bitset_get_unchecked(board->player_two_board, index) << 1);
+}
+
+/**
+ * Same as board_get, without the bounds check.
+ * @param board Board to read.
+ * @param x X coordinate of the tile, must be on the board.
+ * @param y Y coordinate of the tile, must be on the board.
+ * @return Mark on the tile.
+ */
+static inline PlayerMark board_get_unchecked(const Board* board, const uint8_t x, const uint8_t y) {
+    return board_get_index_unchecked(board, y * board->board_size + x);
+}
+
+/**
+ * Same as board_set, without the bounds check.
+ * @param board Board to modify.
+ * @param x X coordinate of the tile, must be on the board.
+ * @param y Y coordinate of the tile, must be on the board.
+ * @param mark Mark to place, X and O must only be placed on an empty tile.
+ */
+static inline void board_set_unchecked(const Board* board, const uint8_t x, const uint8_t y, const PlayerMark mark) {
+    const uint16_t index = y * board->board_size + x;
+
+    if (mark == X) {
+        bitset_set_unchecked(board->player_one_board, index);
+        return;
+    }
+
+    if (mark == O) {
+        bitset_set_unchecked(board->player_two_board, index);
+        return;
+    }
+
+    bitset_clear_unchecked(board->player_one_board, index);
+    bitset_clear_unchecked(board->player_two_board, index);
+}
+
+/**
+ * Same as game_move, without checking that the tile is on the board and empty.
+ * @param game Game to play in.
+ * @param x X coordinate of an empty tile.
+ * @param y Y coordinate of an empty tile.
+ */
+static inline void game_move_unchecked(Game* game, const uint8_t x, const uint8_t y) {
+    const uint16_t index = y * game->board->board_size + x;
+
+    bitset_set_unchecked(game->current_player == X ? game->board->player_one_board : game->board->player_two_board,
+                         index);
+    if (game->history != NULL) {
+        game->history[game->history_length++] = (GameHistoryEntry){index, game->last_x, game->last_y};
+    }
+    game->turns_taken++;
+    game->last_x = x;
+    game->last_y = y;
+    game->hash ^= game_zobrist_key(index, game->current_player) ^ GAME_ZOBRIST_SIDE_KEY;
+    game->current_player = game->current_player == X ? O : X;
+}
+
+/**
+ * Same as game_un_move, without checking that the tile is on the board and occupied (and that it's the last move of
+ * the history).
+ * @param game Game to modify.
+ * @param x X coordinate of the last move.
+ * @param y Y coordinate of the last move.
+ */
+static inline void game_un_move_unchecked(Game* game, const uint8_t x, const uint8_t y) {
+    const uint16_t index = y * game->board->board_size + x;
+    // the tile belongs to the player who isn't to move
+    const PlayerMark existing = game->current_player == X ? O : X;
+
+    bitset_clear_unchecked(existing == X ? game->board->player_one_board : game->board->player_two_board, index);
+    game->turns_taken -= 1;
+    game->hash ^= game_zobrist_key(index, existing) ^ GAME_ZOBRIST_SIDE_KEY;
+    if (game->history != NULL && game->history_length > 0) {
+        const GameHistoryEntry entry = game->history[--game->history_length];
+        game->last_x = entry.previous_last_x;
+        game->last_y = entry.previous_last_y;
+    }
+    else {
+        game->last_x = 0;
+        game->last_y = 0;
+    }
+    game->current_player = existing;
+}
+
+#endif //UNCHECKED_H
@@ -0,0 +1,265 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "bitboard.h"
+
+#include "utils/functions/std_utils.h"
+
+// pattern starts that don't wrap around the board edge, indexed by [board_size][LineDirection][word]
+static uint64_t EDGE_MASKS[BITBOARD_MAX_SIZE + 1][NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS];
+
+// runs once when the library is loaded, so the masks are ready before any (possibly multithreaded) use
+__attribute__((constructor)) static void bitboard_init_edge_masks(void) {
+    for (uint8_t size = 3; size <= BITBOARD_MAX_SIZE; size++) {
+        for (uint8_t y = 0; y < size; y++) {
+            for (uint8_t x = 0; x < size; x++) {
+                const uint16_t index = y * size + x;
+                const uint64_t bit = (uint64_t)1 << (index % 64);
+
+                // check that the other two tiles of the pattern are still on the board
+                if (x + 2 < size) {
+                    EDGE_MASKS[size][HORIZONTAL][index / 64] |= bit;
+                }
+                if (y + 2 < size) {
+                    EDGE_MASKS[size][VERTICAL][index / 64] |= bit;
+                }
+                if (x + 2 < size && y + 2 < size) {
+                    EDGE_MASKS[size][DIAGONAL][index / 64] |= bit;
+                }
+                if (x >= 2 && y + 2 < size) {
+                    EDGE_MASKS[size][ANTI_DIAGONAL][index / 64] |= bit;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Shift a multi-word bit array towards lower indices, so that bit i of the output holds bit i + shift of the input.
+ * @param output Array to write the result to.
+ * @param input Array to shift.
+ * @param shift Number of bits to shift by (1 to 63).
+ * @param num_words Number of words in the arrays.
+ */
+static inline void shift_words(uint64_t* output, const uint64_t* input, const uint8_t shift, const uint8_t num_words) {
+    for (uint8_t i = 0; i < num_words; i++) {
+        const uint64_t carry = i + 1 < num_words ? input[i + 1] << (64 - shift) : 0;
+        output[i] = input[i] >> shift | carry;
+    }
+}
+
+/**
+ * Find patterns in one direction. Bit i of the output is set if tiles i, i + step and i + 2 * step form XOX or OXO.
+ * @param output Array to write the pattern starts to.
+ * @param bitboard Bitboard to search.
+ * @param direction Direction of the patterns.
+ * @param step Index difference between two neighbouring tiles of the pattern.
+ * @param num_words Number of words to process (passed as a constant so the loops can be unrolled).
+ * @return True if at least one pattern was found.
+ */
+static inline bool find_direction(uint64_t* output, const BitBoard* bitboard, const LineDirection direction,
+                                  const uint8_t step, const uint8_t num_words) {
+    uint64_t x_once[BITBOARD_MAX_WORDS], x_twice[BITBOARD_MAX_WORDS];
+    uint64_t o_once[BITBOARD_MAX_WORDS], o_twice[BITBOARD_MAX_WORDS];
+    shift_words(x_once, bitboard->player_one_board, step, num_words);
+    shift_words(x_twice, x_once, step, num_words);
+    shift_words(o_once, bitboard->player_two_board, step, num_words);
+    shift_words(o_twice, o_once, step, num_words);
+
+    const uint64_t* edge_mask = EDGE_MASKS[bitboard->board_size][direction];
+    uint64_t found = 0;
+
+    for (uint8_t i = 0; i < num_words; i++) {
+        const uint64_t xox = bitboard->player_one_board[i] & o_once[i] & x_twice[i];
+        const uint64_t oxo = bitboard->player_two_board[i] & x_once[i] & o_twice[i];
+        output[i] = (xox | oxo) & edge_mask[i];
+        found |= output[i];
+    }
+
+    return found != 0;
+}
+
+/**
+ * Run the pattern search with a constant number of words.
+ * @param patterns Output masks for every direction.
+ * @param bitboard Bitboard to search.
+ * @param num_words Number of words to process.
+ * @param stop_early Return as soon as any direction contains a pattern (the remaining masks are left unset).
+ * @return True if at least one pattern was found.
+ */
+static inline bool find_patterns(uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS], const BitBoard* bitboard,
+                                 const uint8_t num_words, const bool stop_early) {
+    const uint8_t size = bitboard->board_size;
+    bool found = false;
+
+    found |= find_direction(patterns[HORIZONTAL], bitboard, HORIZONTAL, 1, num_words);
+    if (found && stop_early) {
+        return true;
+    }
+
+    found |= find_direction(patterns[VERTICAL], bitboard, VERTICAL, size, num_words);
+    if (found && stop_early) {
+        return true;
+    }
+
+    found |= find_direction(patterns[DIAGONAL], bitboard, DIAGONAL, size + 1, num_words);
+    if (found && stop_early) {
+        return true;
+    }
+
+    found |= find_direction(patterns[ANTI_DIAGONAL], bitboard, ANTI_DIAGONAL, size - 1, num_words);
+    return found;
+}
+
+/**
+ * Dispatch the pattern search to a variant specialized on the number of words.
+ */
+static bool find_patterns_dispatch(uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS],
+                                   const BitBoard* bitboard, const bool stop_early) {
+    switch (bitboard->num_words) {
+    case 1:
+        return find_patterns(patterns, bitboard, 1, stop_early);
+    case 2:
+        return find_patterns(patterns, bitboard, 2, stop_early);
+    default:
+        return find_patterns(patterns, bitboard, 4, stop_early);
+    }
+}
+
+BitBoard bitboard_create(const uint8_t board_size) {
+    if (board_size == 0) {
+        throw_err("bitboard_create", "Board size cannot be 0.");
+    }
+
+    if (board_size > BITBOARD_MAX_SIZE) {
+        throw_err("bitboard_create", "Board size %d doesn't fit into a bitboard (maximum is %d).", board_size,
+                  BITBOARD_MAX_SIZE);
+    }
+
+    BitBoard bitboard = {0};
+    bitboard.board_size = board_size;
+
+    // round the word count up to a power of 2 (64, 128 or 256-bit boards)
+    const uint16_t num_tiles = board_size * board_size;
+    bitboard.num_words = num_tiles <= 64 ? 1 : num_tiles <= 128 ? 2 : 4;
+
+    return bitboard;
+}
+
+BitBoard bitboard_from_board(const Board* board) {
+    if (board == NULL) {
+        throw_err("bitboard_from_board", "Board cannot be NULL.");
+    }
+
+    BitBoard bitboard = bitboard_create(board->board_size);
+
+    // both representations use the same bit order and word size, so the words can be copied directly
+    const size_t num_words = bitset_num_words(board->player_one_board->size);
+    for (size_t i = 0; i < num_words; i++) {
+        bitboard.player_one_board[i] = board->player_one_board->bits[i];
+        bitboard.player_two_board[i] = board->player_two_board->bits[i];
+    }
+
+    return bitboard;
+}
+
+void bitboard_to_board(const BitBoard* bitboard, const Board* board) {
+    if (bitboard->board_size != board->board_size) {
+        throw_err("bitboard_to_board", "Bitboard and board sizes don't match.");
+    }
+
+    // the unused high bits of the bitboard are always 0, like the ones of the bitsets
+    const size_t num_words = bitset_num_words(board->player_one_board->size);
+    for (size_t i = 0; i < num_words; i++) {
+        board->player_one_board->bits[i] = bitboard->player_one_board[i];
+        board->player_two_board->bits[i] = bitboard->player_two_board[i];
+    }
+}
+
+PlayerMark bitboard_get(const BitBoard* bitboard, const uint8_t x, const uint8_t y) {
+    if (x >= bitboard->board_size || y >= bitboard->board_size) {
+        throw_err("bitboard_get", "Board coordinates are out-of-bounds.");
+    }
+
+    const uint16_t index = y * bitboard->board_size + x;
+    const uint64_t bit = (uint64_t)1 << (index % 64);
+
+    if (bitboard->player_one_board[index / 64] & bit) {
+        return X;
+    }
+
+    if (bitboard->player_two_board[index / 64] & bit) {
+        return O;
+    }
+
+    return EMPTY;
+}
+
+void bitboard_set(BitBoard* bitboard, const uint8_t x, const uint8_t y, const PlayerMark mark) {
+    if (x >= bitboard->board_size || y >= bitboard->board_size) {
+        throw_err("bitboard_set", "Board coordinates are out-of-bounds.");
+    }
+
+    const uint16_t index = y * bitboard->board_size + x;
+    const uint64_t bit = (uint64_t)1 << (index % 64);
+
+    if (mark == X) {
+        bitboard->player_one_board[index / 64] |= bit;
+        return;
+    }
+
+    if (mark == O) {
+        bitboard->player_two_board[index / 64] |= bit;
+        return;
+    }
+
+    bitboard->player_one_board[index / 64] &= ~bit;
+    bitboard->player_two_board[index / 64] &= ~bit;
+}
+
+bool bitboard_is_occupied(const BitBoard* bitboard, const uint16_t index) {
+    return ((bitboard->player_one_board[index / 64] | bitboard->player_two_board[index / 64]) >> (index % 64)) & 1;
+}
+
+uint16_t bitboard_count_occupied(const BitBoard* bitboard) {
+    uint16_t count = 0;
+
+    for (uint8_t i = 0; i < bitboard->num_words; i++) {
+        count += __builtin_popcountll(bitboard->player_one_board[i] | bitboard->player_two_board[i]);
+    }
+
+    return count;
+}
+
+void bitboard_find_patterns(const BitBoard* bitboard, uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS]) {
+    for (uint8_t i = 0; i < NUM_LINE_DIRECTIONS; i++) {
+        for (uint8_t j = 0; j < BITBOARD_MAX_WORDS; j++) {
+            patterns[i][j] = 0;
+        }
+    }
+
+    // boards smaller than 3x3 can't contain a pattern (and would need a shift by 0)
+    if (bitboard->board_size < 3) {
+        return;
+    }
+
+    find_patterns_dispatch(patterns, bitboard, false);
+}
+
+const uint64_t* bitboard_edge_mask(const uint8_t board_size, const LineDirection direction) {
+    if (board_size > BITBOARD_MAX_SIZE) {
+        throw_err("bitboard_edge_mask", "Board size %d doesn't fit into a bitboard.", board_size);
+    }
+
+    return EDGE_MASKS[board_size][direction];
+}
+
+bool bitboard_is_win(const BitBoard* bitboard) {
+    if (bitboard->board_size < 3) {
+        return false;
+    }
+
+    uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS];
+    return find_patterns_dispatch(patterns, bitboard, true);
+}
@@ -4,9 +4,11 @@
 
 #include <stdlib.h>
 #include "board.h"
+#include "unchecked.h"
 
 #include <stdio.h>
 
+#include "utils/functions/stat_counters.h"
 #include "utils/functions/std_utils.h"
 
 Board* board_create(const uint8_t board_size) {
@@ -21,6 +23,8 @@ Board* board_create(const uint8_t board_size) {
         return NULL;
     }
 
+    STAT_INC(STAT_BOARD_ALLOCATIONS);
+
     board->board_size = board_size;
     board->player_one_board = bitset_create(board_size * board_size);
     board->player_two_board = bitset_create(board_size * board_size);
@@ -41,6 +45,8 @@ Board* board_clone(const Board* original) {
         return NULL;
     }
 
+    STAT_INC(STAT_BOARD_ALLOCATIONS);
+
     // clone the boards
     board->board_size = original->board_size;
     board->player_one_board = bitset_clone(original->player_one_board);
@@ -49,6 +55,15 @@ Board* board_clone(const Board* original) {
     return board;
 }
 
+void board_copy_into(const Board* target, const Board* source) {
+    if (target->board_size != source->board_size) {
+        throw_err("board_copy_into", "Board sizes don't match.");
+    }
+
+    bitset_copy_into(target->player_one_board, source->player_one_board);
+    bitset_copy_into(target->player_two_board, source->player_two_board);
+}
+
 void board_free(Board* board) {
     if (board == NULL) {
         return;
@@ -67,6 +82,8 @@ void board_free(Board* board) {
 }
 
 PlayerMark board_get(const Board* board, const uint8_t x, const uint8_t y) {
+    STAT_INC(STAT_BOARD_GETS);
+
     // calculate the index of the tile's bit
     const uint16_t index = y * board->board_size + x;
 
@@ -75,17 +92,16 @@ PlayerMark board_get(const Board* board, const uint8_t x, const uint8_t y) {
         throw_err("board_get", "Board coordinates are out-of-bounds.");
     }
 
-    // check if player one is occupying the tile
-    if (bitset_get(board->player_one_board, index)) {
-        return X;
-    }
+    return board_get_index_unchecked(board, index);
+}
 
-    // check if player two is occupying the tile
-    if (bitset_get(board->player_two_board, index)) {
-        return O;
+PlayerMark board_get_index(const Board* board, const uint16_t index) {
+    // check that the index is in-bounds
+    if (index >= board->player_one_board->size) {
+        throw_err("board_get_index", "Tile index is out-of-bounds.");
     }
 
-    return EMPTY;
+    return board_get_index_unchecked(board, index);
 }
 
 void board_set(const Board* board, const uint8_t x, const uint8_t y, const PlayerMark mark) {
@@ -97,44 +113,79 @@ void board_set(const Board* board, const uint8_t x, const uint8_t y, const Playe
         throw_err("board_set", "Board coordinates are out-of-bounds.");
     }
 
-    if (mark == X) {
-        bitset_set(board->player_one_board, index);
-        return;
-    }
-
-    if (mark == O) {
-        bitset_set(board->player_two_board, index);
-        return;
-    }
-
-    bitset_clear(board->player_one_board, index);
-    bitset_clear(board->player_two_board, index);
+    board_set_unchecked(board, x, y, mark);
 }
 
 bool board_coordinates_in_bounds(const Board* board, const short x, const short y) {
     return x >= 0 && y >= 0 && x < board->board_size && y < board->board_size;
 }
 
-void board_get_legal_moves(uint8_t move_buffer[][2], const Board* board) {
+/**
+ * Load one word of the empty tile mask.
+ * @param board Board to read from.
+ * @param word_index Index of the word in the bitsets.
+ * @return Word with a set bit for every empty tile (bits past the end of the board are 0).
+ */
+static inline uint64_t load_empty_word(const Board* board, const size_t word_index) {
+    const uint64_t occupied = board->player_one_board->bits[word_index] | board->player_two_board->bits[word_index];
+
+    // clear the bits after the last tile
+    const size_t remaining_bits = board->player_one_board->size - word_index * 64;
+    const uint64_t valid = remaining_bits >= 64 ? UINT64_MAX : ((uint64_t)1 << remaining_bits) - 1;
+
+    return ~occupied & valid;
+}
+
+uint16_t board_get_legal_moves(uint8_t move_buffer[][2], const Board* board) {
+    const size_t num_words = bitset_num_words(board->player_one_board->size);
     // index where to put the next legal move
     uint16_t move_index = 0;
+    // the tiles come in increasing order, so the coordinates can be tracked without dividing
+    uint16_t row_start = 0;
+    uint8_t y = 0;
 
-    for (uint8_t y = 0; y < board->board_size; y++) {
-        for (uint8_t x = 0; x < board->board_size; x++) {
-            if (board_get(board, x, y) == EMPTY) {
-                move_buffer[move_index][0] = x;
-                move_buffer[move_index][1] = y;
-                move_index++;
+    for (size_t word_index = 0; word_index < num_words; word_index++) {
+        uint64_t empty = load_empty_word(board, word_index);
+
+        while (empty != 0) {
+            const uint16_t tile = word_index * 64 + __builtin_ctzll(empty);
+            empty &= empty - 1; // clear the lowest set bit
+
+            while (tile >= row_start + board->board_size) {
+                row_start += board->board_size;
+                y++;
             }
+
+            move_buffer[move_index][0] = tile - row_start;
+            move_buffer[move_index][1] = y;
+            move_index++;
         }
     }
+
+    return move_index;
+}
+
+uint16_t board_get_legal_tiles(uint16_t* tile_buffer, const Board* board) {
+    const size_t num_words = bitset_num_words(board->player_one_board->size);
+    uint16_t move_index = 0;
+
+    for (size_t word_index = 0; word_index < num_words; word_index++) {
+        uint64_t empty = load_empty_word(board, word_index);
+
+        while (empty != 0) {
+            tile_buffer[move_index++] = word_index * 64 + __builtin_ctzll(empty);
+            empty &= empty - 1; // clear the lowest set bit
+        }
+    }
+
+    return move_index;
 }
 
 void board_shuffle_moves(uint8_t move_array[][2], const uint16_t length) {
     // iterate through the moves
-    for (uint16_t i = 0; i < length - 1; i++) {
-        // randomly generate an index between "i + 1" and the last index
-        const uint16_t j = rand() % (length - (i + 1)) + i + 1;
+    for (uint16_t i = 0; i + 1 < length; i++) {
+        // randomly generate an index between "i" and the last index (the move can stay in place)
+        const uint16_t j = rand() % (length - i) + i;
 
         // create temporary variable to hold the move
         const uint8_t t_x = move_array[i][0];
@@ -148,13 +199,28 @@ void board_shuffle_moves(uint8_t move_array[][2], const uint16_t length) {
     }
 }
 
+void board_shuffle_moves_rng(uint8_t move_array[][2], const uint16_t length, Rng* rng) {
+    for (uint16_t i = 0; i + 1 < length; i++) {
+        // randomly generate an index between "i" and the last index (the move can stay in place)
+        const uint16_t j = i + rng_below(rng, length - i);
+
+        const uint8_t t_x = move_array[i][0];
+        const uint8_t t_y = move_array[i][1];
+
+        move_array[i][0] = move_array[j][0];
+        move_array[i][1] = move_array[j][1];
+        move_array[j][0] = t_x;
+        move_array[j][1] = t_y;
+    }
+}
+
 void board_to_string(const Board* board, char* buffer) {
     // loop over the lines
     for (uint8_t y = 0; y < board->board_size; y++) {
         // loop over the columns
         for (uint8_t x = 0; x < board->board_size; x++) {
             // get the mark at the position
-            const PlayerMark mark = board_get(board, x, y);
+            const PlayerMark mark = board_get_unchecked(board, x, y);
             // using ternary operations decide which character to place
             buffer[y * board->board_size + x] = mark == X ? 'X' : (mark == O) ? 'O' : '_';
         }
@@ -184,7 +250,7 @@ void board_print(const Board* board) {
     for (uint8_t y = 0; y < board->board_size; y++) {
         for (uint8_t x = 0; x < board->board_size; x++) {
             // get the mark at the position
-            const PlayerMark mark = board_get(board, x, y);
+            const PlayerMark mark = board_get_unchecked(board, x, y);
             // using ternary operations decide which character to print
             printf("%c ", mark == X ? 'X' : (mark == O) ? 'O' : '_');
         }
@@ -4,8 +4,16 @@
 
 #include "game.h"
 
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "bitboard.h"
+#include "playout_batch.h"
+#include "unchecked.h"
+
+#include "utils/functions/stat_counters.h"
 #include "utils/functions/std_utils.h"
 
 const uint8_t NUM_WIN_OFFSETS = 12;
@@ -28,6 +36,97 @@ const char WIN_OFFSETS[NUM_WIN_OFFSETS][3][2] = {
     {{-1, -1}, {0, 0}, {1, 1}}
 };
 
+// WIN_OFFSETS resolved for every tile of a board size, with the lines that leave the board already removed
+typedef struct
+{
+    uint8_t* line_counts; // number of lines through each tile
+    uint16_t (*lines)[NUM_WIN_OFFSETS][3]; // tile indices of the lines through each tile
+} WinLineTable;
+
+// tables are built once per board size and shared by all games of that size (they're never freed)
+static _Atomic(WinLineTable*) WIN_LINE_TABLES[256];
+
+/**
+ * Build the win line table for a board size.
+ * @param board_size Size of the board along one axis.
+ * @return Pointer to a newly allocated table.
+ */
+static WinLineTable* win_line_table_create(const uint8_t board_size) {
+    const uint16_t num_tiles = board_size * board_size;
+
+    WinLineTable* table = malloc(sizeof(WinLineTable));
+    if (table == NULL) {
+        throw_err("win_line_table_create", "Couldn't allocate memory for a win line table.");
+        return NULL;
+    }
+
+    table->line_counts = calloc(num_tiles, sizeof(uint8_t));
+    table->lines = malloc(num_tiles * sizeof(*table->lines));
+    if (table->line_counts == NULL || table->lines == NULL) {
+        throw_err("win_line_table_create", "Couldn't allocate memory for the win lines.");
+        return NULL;
+    }
+
+    for (uint8_t y = 0; y < board_size; y++) {
+        for (uint8_t x = 0; x < board_size; x++) {
+            const uint16_t tile = y * board_size + x;
+
+            for (uint8_t i = 0; i < NUM_WIN_OFFSETS; i++) {
+                // the line is kept only if all 3 of its tiles are on the board
+                bool in_bounds = true;
+                uint16_t line[3];
+
+                for (uint8_t j = 0; j < 3; j++) {
+                    const short line_x = x + WIN_OFFSETS[i][j][0];
+                    const short line_y = y + WIN_OFFSETS[i][j][1];
+
+                    if (line_x < 0 || line_y < 0 || line_x >= board_size || line_y >= board_size) {
+                        in_bounds = false;
+                        break;
+                    }
+
+                    line[j] = line_y * board_size + line_x;
+                }
+
+                if (!in_bounds) {
+                    continue;
+                }
+
+                const uint8_t line_index = table->line_counts[tile]++;
+                for (uint8_t j = 0; j < 3; j++) {
+                    table->lines[tile][line_index][j] = line[j];
+                }
+            }
+        }
+    }
+
+    return table;
+}
+
+/**
+ * Return the win line table for a board size, building it on first use.
+ * @param board_size Size of the board along one axis.
+ * @return Pointer to the shared table.
+ */
+static const WinLineTable* get_win_line_table(const uint8_t board_size) {
+    WinLineTable* table = atomic_load_explicit(&WIN_LINE_TABLES[board_size], memory_order_acquire);
+
+    if (table != NULL) {
+        return table;
+    }
+
+    // build the table and publish it, if another thread was faster, use its table instead
+    WinLineTable* created = win_line_table_create(board_size);
+    if (atomic_compare_exchange_strong(&WIN_LINE_TABLES[board_size], &table, created)) {
+        return created;
+    }
+
+    free(created->line_counts);
+    free(created->lines);
+    free(created);
+    return table;
+}
+
 Game* game_create(const uint8_t board_size) {
     Game* game = malloc(sizeof(Game));
 
@@ -36,15 +135,122 @@ Game* game_create(const uint8_t board_size) {
         return NULL;
     }
 
+    STAT_INC(STAT_GAME_ALLOCATIONS);
+
     game->board = board_create(board_size);
     game->turns_taken = 0;
 
+    // make sure the win lines are ready before the first win check
+    get_win_line_table(board_size);
+
     // this is potentially dangerous because instead of having invalid values, (0,0) coordinates will work
     // in function, potentially producing unexpected behaviour without errors, as a trade-off we're decreasing memory
     // usage because the char is unsigned
     game->last_x = 0;
     game->last_y = 0;
     game->current_player = X;
+    game->hash = game_zobrist_board_key(board_size);
+    game->history = NULL;
+    game->history_length = 0;
+    game->in_arena = false;
+    return game;
+}
+
+// memory layout of a game created in an arena, everything is in one contiguous block
+typedef struct
+{
+    Game game;
+    Board board;
+    BitSet player_one_board;
+    BitSet player_two_board;
+    alignas(BITSET_ALIGNMENT) uint64_t bits[]; // data of both bitsets, one after the other
+} GameBlock;
+
+/**
+ * Reserve a game block in an arena and connect its pointers. The bitset data isn't initialized.
+ * @param arena Arena to allocate from.
+ * @param board_size Size of the board along one axis.
+ * @param block_size Output for the total number of bytes in the block.
+ * @return Pointer to the block.
+ */
+static GameBlock* game_block_alloc(OxoxArena* arena, const uint8_t board_size, size_t* block_size) {
+    if (board_size == 0) {
+        throw_err("game_block_alloc", "Board size cannot be 0.");
+    }
+
+    const size_t num_tiles = board_size * board_size;
+    const size_t num_words = bitset_reserved_words(num_tiles);
+    *block_size = sizeof(GameBlock) + 2 * num_words * sizeof(uint64_t);
+
+    // the arena only aligns for the standard types, so the block is moved forward to align the bitset data
+    const uintptr_t address = (uintptr_t)oxox_arena_alloc(arena, *block_size + BITSET_ALIGNMENT - 1);
+    GameBlock* block = (GameBlock*)((address + BITSET_ALIGNMENT - 1) & ~(uintptr_t)(BITSET_ALIGNMENT - 1));
+
+    block->player_one_board.bits = block->bits;
+    block->player_one_board.size = num_tiles;
+    block->player_two_board.bits = block->bits + num_words;
+    block->player_two_board.size = num_tiles;
+    block->board.player_one_board = &block->player_one_board;
+    block->board.player_two_board = &block->player_two_board;
+    block->board.board_size = board_size;
+    block->game.board = &block->board;
+    block->game.in_arena = true;
+
+    return block;
+}
+
+Game* game_create_in(OxoxArena* arena, const uint8_t board_size) {
+    if (arena == NULL) {
+        throw_err("game_create_in", "Arena cannot be NULL.");
+        return NULL;
+    }
+
+    size_t block_size;
+    GameBlock* block = game_block_alloc(arena, board_size, &block_size);
+    memset(block->bits, 0, block_size - sizeof(GameBlock));
+
+    Game* game = &block->game;
+    game->turns_taken = 0;
+    game->last_x = 0;
+    game->last_y = 0;
+    game->current_player = X;
+    game->hash = game_zobrist_board_key(board_size);
+    game->history = NULL;
+    game->history_length = 0;
+
+    // make sure the win lines are ready before the first win check
+    get_win_line_table(board_size);
+
+    return game;
+}
+
+Game* game_clone_in(OxoxArena* arena, const Game* original) {
+    if (arena == NULL || original == NULL) {
+        throw_err("game_clone_in", "Arena and game cannot be NULL.");
+        return NULL;
+    }
+
+    size_t block_size;
+    GameBlock* block = game_block_alloc(arena, original->board->board_size, &block_size);
+
+    // a game from an arena has the same layout, so the data of both bitsets can be copied at once
+    if (original->in_arena) {
+        const GameBlock* original_block = (const GameBlock*)original;
+        memcpy(block->bits, original_block->bits, block_size - sizeof(GameBlock));
+    }
+    else {
+        board_copy_into(&block->board, original->board);
+    }
+
+    Game* game = &block->game;
+    game->turns_taken = original->turns_taken;
+    game->last_x = original->last_x;
+    game->last_y = original->last_y;
+    game->current_player = original->current_player;
+    game->hash = original->hash;
+    game->history = NULL;
+    game->history_length = 0;
+
     return game;
 }
 
@@ -61,20 +267,49 @@ Game* game_clone(const Game* original) {
         return NULL;
     }
 
+    STAT_INC(STAT_GAME_ALLOCATIONS);
+
     game->board = board_clone(original->board);
     game->turns_taken = original->turns_taken;
     game->last_x = original->last_x;
     game->last_y = original->last_y;
     game->current_player = original->current_player;
+    game->hash = original->hash;
+    game->history = NULL;
+    game->history_length = 0;
+    game->in_arena = false;
+
+    if (original->history != NULL) {
+        game_enable_history(game);
+        memcpy(game->history, original->history, original->history_length * sizeof(GameHistoryEntry));
+        game->history_length = original->history_length;
+    }
 
     return game;
 }
 
+void game_copy_into(Game* target, const Game* source) {
+    board_copy_into(target->board, source->board);
+    target->turns_taken = source->turns_taken;
+    target->last_x = source->last_x;
+    target->last_y = source->last_y;
+    target->current_player = source->current_player;
+    target->hash = source->hash;
+
+    if (target->history != NULL) {
+        target->history_length = source->history != NULL ? source->history_length : 0;
+        if (target->history_length > 0) {
+            memcpy(target->history, source->history, source->history_length * sizeof(GameHistoryEntry));
+        }
+    }
+}
+
 void game_free(Game* game) {
     if (game == NULL) {
         return;
     }
 
+    game_disable_history(game);
     board_free(game->board);
     game->board = NULL;
     free(game);
@@ -86,17 +321,15 @@ void game_move(Game* game, const uint8_t x, const uint8_t y) {
         return;
     }
 
+    STAT_INC(STAT_MOVES);
+
     const PlayerMark existing = board_get(game->board, x, y);
 
     if (existing != EMPTY) {
         throw_err("game_move", "This move is illegal. The tile is already occupied.");
     }
 
-    board_set(game->board, x, y, game->current_player);
-    game->turns_taken++;
-    game->last_x = x;
-    game->last_y = y;
-    game->current_player = game->current_player == X ? O : X;
+    game_move_unchecked(game, x, y);
 }
 
 void game_un_move(Game* game, const uint8_t x, const uint8_t y) {
@@ -106,18 +339,89 @@ void game_un_move(Game* game, const uint8_t x, const uint8_t y) {
         throw_err("game_un_move", "Can't un-move an empty tile.");
     }
 
-    board_set(game->board, x, y, EMPTY);
-    game->turns_taken -= 1;
+    const uint16_t index = y * game->board->board_size + x;
 
-    // this is potentially dangerous because instead of having invalid values, (0,0) coordinates will work
-    // in function, potentially producing unexpected behaviour without errors, as a trade-off we're decreasing memory
-    // usage because the char is unsigned
-    game->last_x = 0;
-    game->last_y = 0;
+    if (game->history != NULL && game->history_length > 0) {
+        const GameHistoryEntry entry = game->history[game->history_length - 1];
+        if (entry.tile != index) {
+            throw_err("game_un_move", "Only the last move can be reverted when the history is enabled.");
+        }
+
+        game->history_length--;
+        game->last_x = entry.previous_last_x;
+        game->last_y = entry.previous_last_y;
+    }
+    else {
+        // this is potentially dangerous because instead of having invalid values, (0,0) coordinates will work
+        // in function, potentially producing unexpected behaviour without errors, as a trade-off we're decreasing
+        // memory usage because the char is unsigned
+        game->last_x = 0;
+        game->last_y = 0;
+    }
+
+    board_set_unchecked(game->board, x, y, EMPTY);
+    game->turns_taken -= 1;
+    game->hash ^= game_zobrist_key(index, existing) ^ GAME_ZOBRIST_SIDE_KEY;
 
     game->current_player = game->current_player == X ? O : X;
 }
 
+void game_undo(Game* game) {
+    if (game == NULL || game->history == NULL || game->history_length == 0) {
+        throw_err("game_undo", "There is no recorded move to take back.");
+        return;
+    }
+
+    const uint8_t board_size = game->board->board_size;
+    const uint16_t tile = game->history[game->history_length - 1].tile;
+    game_un_move_unchecked(game, tile % board_size, tile / board_size);
+}
+
+void game_enable_history(Game* game) {
+    if (game == NULL) {
+        throw_err("game_enable_history", "Game cannot be NULL.");
+        return;
+    }
+
+    if (game->history != NULL) {
+        return;
+    }
+
+    const uint16_t num_tiles = game->board->board_size * game->board->board_size;
+    game->history = malloc(num_tiles * sizeof(GameHistoryEntry));
+    if (game->history == NULL) {
+        throw_err("game_enable_history", "Couldn't allocate memory for the move history.");
+    }
+    game->history_length = 0;
+}
+
+void game_disable_history(Game* game) {
+    free(game->history);
+    game->history = NULL;
+    game->history_length = 0;
+}
+
+uint64_t game_compute_hash(const Game* game) {
+    if (game == NULL) {
+        throw_err("game_compute_hash", "Game cannot be NULL.");
+    }
+
+    const uint16_t num_tiles = game->board->board_size * game->board->board_size;
+    uint64_t hash = game_zobrist_board_key(game->board->board_size);
+    if (game->current_player == O) {
+        hash ^= GAME_ZOBRIST_SIDE_KEY;
+    }
+
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        const PlayerMark mark = board_get_index_unchecked(game->board, i);
+        if (mark != EMPTY) {
+            hash ^= game_zobrist_key(i, mark);
+        }
+    }
+
+    return hash;
+}
+
 bool game_is_tie(const Game* game) {
     return game->turns_taken == game->board->board_size * game->board->board_size;
 }
@@ -128,43 +432,30 @@ bool game_is_win(const Game* game) {
         return false;
     }
 
-    // try every offset from the last move
-    for (uint8_t i = 0; i < NUM_WIN_OFFSETS; i++) {
-        // assume this offset is winning till proven otherwise
-        bool winning = true;
-
-        // go through the 3 position offsets
-        // because the tiles in the patterns (OXO and XOX) are switching, we can compare each mark with the previous one
-        PlayerMark previous_mark = EMPTY;
-        for (uint8_t j = 0; j < 3; j++) {
-            // extract the x and y components of the position
-            const short x = game->last_x + WIN_OFFSETS[i][j][0];
-            const short y = game->last_y + WIN_OFFSETS[i][j][1];
+    STAT_INC(STAT_WIN_CHECKS);
 
-            // check that we haven't gotten outside the board
-            if (!board_coordinates_in_bounds(game->board, x, y)) {
-                winning = false;
-                break;
-            }
-
-            const PlayerMark mark = board_get(game->board, x, y);
+    const Board* board = game->board;
+    const WinLineTable* table = get_win_line_table(board->board_size);
+    const uint16_t tile = game->last_y * board->board_size + game->last_x;
 
-            if (mark == EMPTY) {
-                winning = false;
-                break;
-            }
+    // try every line through the last move
+    for (uint8_t i = 0; i < table->line_counts[tile]; i++) {
+        const uint16_t* line = table->lines[tile][i];
 
-            // check if the pattern was broken
-            if (mark == previous_mark) {
-                winning = false;
-                break;
-            }
+        // because the tiles in the patterns (OXO and XOX) are switching, the middle mark has to differ from the
+        // outer ones, which have to be equal
+        const PlayerMark first = board_get_index_unchecked(board, line[0]);
+        if (first == EMPTY) {
+            continue;
+        }
 
-            previous_mark = mark;
+        const PlayerMark middle = board_get_index_unchecked(board, line[1]);
+        if (middle == EMPTY || middle == first) {
+            continue;
         }
 
         // end the search if we already got a winning pattern
-        if (winning) {
+        if (board_get_index_unchecked(board, line[2]) == first) {
             return true;
         }
     }
@@ -172,22 +463,106 @@ bool game_is_win(const Game* game) {
     return false;
 }
 
-float game_random_play(Game* game) {
+bool game_is_win_full(const Game* game) {
     if (game == NULL) {
-        throw_err("game_random_play", "Game cannot be NULL.");
-        return 0.0f;
+        throw_err("game_is_win_full", "Game cannot be NULL.");
+        return false;
+    }
+
+    STAT_INC(STAT_WIN_CHECKS);
+
+    const uint8_t size = game->board->board_size;
+
+    if (size <= BITBOARD_MAX_SIZE) {
+        const BitBoard bitboard = bitboard_from_board(game->board);
+        return bitboard_is_win(&bitboard);
+    }
+
+    // larger boards don't fit into a bitboard, check the patterns starting at every tile instead
+    // (the first 4 outward offsets cover all 4 directions)
+    for (uint8_t y = 0; y < size; y++) {
+        for (uint8_t x = 0; x < size; x++) {
+            const PlayerMark first = board_get_unchecked(game->board, x, y);
+
+            if (first == EMPTY) {
+                continue;
+            }
+
+            for (uint8_t i = 0; i < 4; i++) {
+                const short x1 = x + WIN_OFFSETS[i][1][0];
+                const short y1 = y + WIN_OFFSETS[i][1][1];
+                const short x2 = x + WIN_OFFSETS[i][2][0];
+                const short y2 = y + WIN_OFFSETS[i][2][1];
+
+                if (!board_coordinates_in_bounds(game->board, x2, y2)) {
+                    continue;
+                }
+
+                const PlayerMark middle = board_get_unchecked(game->board, x1, y1);
+                if (middle != EMPTY && middle != first && board_get_unchecked(game->board, x2, y2) == first) {
+                    return true;
+                }
+            }
+        }
     }
 
+    return false;
+}
+
+/**
+ * Move a random not yet played move to a position in the buffer. This is one step of the Fisher-Yates shuffle, so
+ * drawing the moves one by one gives the same distribution as shuffling the whole buffer up front.
+ * @param move_buffer Moves, the ones before the position were already played.
+ * @param position Index where the drawn move is placed.
+ * @param num_legal_moves Number of moves in the buffer.
+ * @param rng Generator to draw from, or NULL to use rand().
+ */
+static inline void draw_move(uint8_t move_buffer[][2], const uint16_t position, const uint16_t num_legal_moves,
+                             Rng* rng) {
+    const uint16_t remaining = num_legal_moves - position;
+    const uint16_t j = position + (rng != NULL ? rng_below(rng, remaining) : (uint32_t)rand() % remaining);
+
+    const uint8_t t_x = move_buffer[position][0];
+    const uint8_t t_y = move_buffer[position][1];
+    move_buffer[position][0] = move_buffer[j][0];
+    move_buffer[position][1] = move_buffer[j][1];
+    move_buffer[j][0] = t_x;
+    move_buffer[j][1] = t_y;
+}
+
+/**
+ * Play random moves one by one until a win or a draw is reached. Each move is drawn lazily right before it's played,
+ * so no random numbers are wasted on the moves after the game is already decided.
+ * @param game Game position to play from. The game instance will be modified.
+ * @param move_buffer All the legal moves of the position (in any order).
+ * @param num_legal_moves Number of moves in the buffer.
+ * @param rng Generator to draw the moves with, or NULL to use rand().
+ * @return 1 if the starting player won, -1 if he lost, 0 for draw.
+ */
+static float play_out_moves(Game* game, uint8_t move_buffer[][2], const uint16_t num_legal_moves, Rng* rng) {
     const PlayerMark starting_player = game->current_player;
-    const uint16_t num_of_tiles = game->board->board_size * game->board->board_size;
 
-    // gather all the moves that are legal in the starting position
-    const uint16_t num_legal_moves = num_of_tiles - game->turns_taken;
-    uint8_t legal_moves[num_legal_moves][2];
-    board_get_legal_moves(legal_moves, game->board);
+    // boards that fit into a bitboard are mirrored in one, so the win check is a few word operations per move
+    if (game->board->board_size <= BITBOARD_MAX_SIZE) {
+        BitBoard bitboard = bitboard_from_board(game->board);
+
+        for (uint16_t i = 0; i < num_legal_moves; i++) {
+            if (bitboard_is_win(&bitboard)) {
+                return game->current_player == starting_player ? -1 : 1;
+            }
+
+            draw_move(move_buffer, i, num_legal_moves, rng);
+            bitboard_set(&bitboard, move_buffer[i][0], move_buffer[i][1], game->current_player);
+            game_move_unchecked(game, move_buffer[i][0], move_buffer[i][1]);
+        }
 
-    // shuffle the moves to get a random play
-    board_shuffle_moves(legal_moves, num_legal_moves);
+        // the last move could have completed a pattern as well
+        if (bitboard_is_win(&bitboard)) {
+            return game->current_player == starting_player ? -1 : 1;
+        }
+
+        return 0;
+    }
 
     // play out the randomized moves one by one until a win or a draw is reached
     for (uint16_t i = 0; i < num_legal_moves; i++) {
@@ -198,21 +573,228 @@ float game_random_play(Game* game) {
 
         // OPTIMIZATION: we don't have to check for a draw, because we know there are still legal moves to play
 
-        // make the move
-        game_move(game, legal_moves[i][0], legal_moves[i][1]);
+        // pick the next move and make it
+        draw_move(move_buffer, i, num_legal_moves, rng);
+        game_move_unchecked(game, move_buffer[i][0], move_buffer[i][1]);
+    }
+
+    // the move that filled the board could have completed a pattern as well
+    if (num_legal_moves > 0 && game_is_win(game)) {
+        return game->current_player == starting_player ? -1 : 1;
     }
 
     // the game ends in a draw if all the moves are depleted
     return 0;
 }
 
+float game_random_play(Game* game) {
+    if (game == NULL) {
+        throw_err("game_random_play", "Game cannot be NULL.");
+        return 0.0f;
+    }
+
+    // the move list can be too large for the stack on big boards
+    const uint16_t num_of_tiles = game->board->board_size * game->board->board_size;
+    uint8_t (*move_buffer)[2] = malloc(num_of_tiles * sizeof(*move_buffer));
+    if (move_buffer == NULL) {
+        throw_err("game_random_play", "Couldn't allocate memory for the legal moves.");
+        return 0.0f;
+    }
+
+    const float result = game_random_play_with_buffer(game, move_buffer);
+    free(move_buffer);
+    return result;
+}
+
+float game_random_play_with_buffer(Game* game, uint8_t move_buffer[][2]) {
+    if (game == NULL) {
+        throw_err("game_random_play_with_buffer", "Game cannot be NULL.");
+        return 0.0f;
+    }
+
+    // gather all the moves that are legal in the starting position, they're shuffled lazily during the play
+    const uint16_t num_legal_moves = board_get_legal_moves(move_buffer, game->board);
+
+    const uint16_t turns_before = game->turns_taken;
+    const float result = play_out_moves(game, move_buffer, num_legal_moves, NULL);
+    stats_record_playout(game->turns_taken - turns_before, (int)result);
+    return result;
+}
+
+float game_random_play_rng(Game* game, uint8_t move_buffer[][2], Rng* rng) {
+    if (game == NULL || rng == NULL) {
+        throw_err("game_random_play_rng", "Game and generator cannot be NULL.");
+        return 0.0f;
+    }
+
+    // gather all the moves that are legal in the starting position, they're shuffled lazily during the play
+    const uint16_t num_legal_moves = board_get_legal_moves(move_buffer, game->board);
+
+    const uint16_t turns_before = game->turns_taken;
+    const float result = play_out_moves(game, move_buffer, num_legal_moves, rng);
+    stats_record_playout(game->turns_taken - turns_before, (int)result);
+    return result;
+}
+
 float game_rollout(const Game* position, const unsigned int num_iterations) {
+    if (position == NULL) {
+        throw_err("game_rollout", "Position cannot be NULL.");
+        return 0.0f;
+    }
+
+    RolloutScratch* scratch = rollout_scratch_create(position->board->board_size);
+    const float result = game_rollout_with_scratch(position, num_iterations, scratch);
+    rollout_scratch_free(scratch);
+
+    return result;
+}
+
+RolloutScratch* rollout_scratch_create(const uint8_t board_size) {
+    RolloutScratch* scratch = malloc(sizeof(RolloutScratch));
+    if (scratch == NULL) {
+        throw_err("rollout_scratch_create", "Couldn't allocate memory for rollout scratch.");
+        return NULL;
+    }
+
+    scratch->game = game_create(board_size);
+    scratch->move_buffer = malloc(board_size * board_size * sizeof(*scratch->move_buffer));
+    if (scratch->move_buffer == NULL) {
+        throw_err("rollout_scratch_create", "Couldn't allocate memory for the move buffer.");
+        return NULL;
+    }
+
+    return scratch;
+}
+
+void rollout_scratch_free(RolloutScratch* scratch) {
+    if (scratch == NULL) {
+        return;
+    }
+
+    game_free(scratch->game);
+    free(scratch->move_buffer);
+    scratch->game = NULL;
+    scratch->move_buffer = NULL;
+    free(scratch);
+}
+
+float game_rollout_with_scratch(const Game* position, const unsigned int num_iterations, RolloutScratch* scratch) {
+    if (position == NULL || scratch == NULL) {
+        throw_err("game_rollout_with_scratch", "Position and scratch cannot be NULL.");
+        return 0.0f;
+    }
+
     float score_sum = 0;
 
-    for (int i = 0; i < num_iterations; i++) {
-        Game* game = game_clone(position);
-        score_sum += game_random_play(game);
+    for (unsigned int i = 0; i < num_iterations; i++) {
+        // restore the starting position in the scratch game instead of cloning it
+        game_copy_into(scratch->game, position);
+        score_sum += game_random_play_with_buffer(scratch->game, scratch->move_buffer);
     }
 
     return score_sum / (float)num_iterations;
 }
+
+float game_rollout_rng(const Game* position, const unsigned int num_iterations, RolloutScratch* scratch, Rng* rng) {
+    if (position == NULL || scratch == NULL || rng == NULL) {
+        throw_err("game_rollout_rng", "Position, scratch and generator cannot be NULL.");
+        return 0.0f;
+    }
+
+    float score_sum = 0;
+
+    for (unsigned int i = 0; i < num_iterations; i++) {
+        game_copy_into(scratch->game, position);
+        score_sum += game_random_play_rng(scratch->game, scratch->move_buffer, rng);
+    }
+
+    return score_sum / (float)num_iterations;
+}
+
+// work assigned to one rollout thread
+typedef struct
+{
+    const Game* position;
+    unsigned int num_iterations;
+    Rng rng;
+    long long score_sum; // sum of the integer play results, so the reduction doesn't depend on rounding order
+} RolloutWorker;
+
+/**
+ * Thread entry point, play the worker's share of the iterations on its own copy of the position.
+ * @param argument Pointer to the RolloutWorker.
+ * @return Always NULL.
+ */
+static void* rollout_worker_run(void* argument) {
+    RolloutWorker* worker = argument;
+
+    // small boards are played many games at a time
+    if (worker->position->board->board_size <= PLAYOUT_BATCH_MAX_SIZE) {
+        PlayoutBatch batch;
+        for (unsigned int i = 0; i < worker->num_iterations; i += PLAYOUT_BATCH_LANES) {
+            const unsigned int remaining = worker->num_iterations - i;
+            const uint8_t num_lanes = remaining < PLAYOUT_BATCH_LANES ? remaining : PLAYOUT_BATCH_LANES;
+            worker->score_sum += playout_batch_run(&batch, worker->position, num_lanes, &worker->rng);
+        }
+        return NULL;
+    }
+
+    RolloutScratch* scratch = rollout_scratch_create(worker->position->board->board_size);
+
+    for (unsigned int i = 0; i < worker->num_iterations; i++) {
+        game_copy_into(scratch->game, worker->position);
+        worker->score_sum += (long long)game_random_play_rng(scratch->game, scratch->move_buffer, &worker->rng);
+    }
+
+    rollout_scratch_free(scratch);
+    return NULL;
+}
+
+float game_rollout_parallel(const Game* position, const unsigned int num_iterations, const unsigned int num_threads,
+                            const uint64_t seed) {
+    if (position == NULL) {
+        throw_err("game_rollout_parallel", "Position cannot be NULL.");
+        return 0.0f;
+    }
+
+    if (num_threads == 0) {
+        throw_err("game_rollout_parallel", "Number of threads cannot be 0.");
+    }
+
+    RolloutWorker* workers = malloc(num_threads * sizeof(RolloutWorker));
+    pthread_t* threads = malloc(num_threads * sizeof(pthread_t));
+    if (workers == NULL || threads == NULL) {
+        throw_err("game_rollout_parallel", "Couldn't allocate memory for the rollout workers.");
+        return 0.0f;
+    }
+
+    // split the iterations as evenly as possible and give every worker its own stream split from the seed
+    Rng rng;
+    rng_seed(&rng, seed);
+    for (unsigned int i = 0; i < num_threads; i++) {
+        workers[i].position = position;
+        workers[i].num_iterations = num_iterations / num_threads + (i < num_iterations % num_threads ? 1 : 0);
+        workers[i].score_sum = 0;
+        workers[i].rng = rng_split(&rng);
+    }
+
+    // the calling thread runs the first worker itself
+    for (unsigned int i = 1; i < num_threads; i++) {
+        if (pthread_create(&threads[i], NULL, rollout_worker_run, &workers[i]) != 0) {
+            throw_err("game_rollout_parallel", "Couldn't start a rollout thread.");
+        }
+    }
+    rollout_worker_run(&workers[0]);
+
+    // add up the results in worker order
+    long long score_sum = workers[0].score_sum;
+    for (unsigned int i = 1; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+        score_sum += workers[i].score_sum;
+    }
+
+    free(workers);
+    free(threads);
+
+    return (float)score_sum / (float)num_iterations;
+}
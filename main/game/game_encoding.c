@@ -0,0 +1,234 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <string.h>
+
+#include "game_encoding.h"
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+_Static_assert(sizeof(GameEncodingHeader) == 8, "Encoded position header must not contain padding.");
+
+/**
+ * Return the number of bytes the tiles of one player take up.
+ */
+static size_t board_bytes(const uint8_t board_size) {
+    return ((size_t)board_size * board_size + 7) / 8;
+}
+
+size_t game_encoded_size(const uint8_t board_size) {
+    return sizeof(GameEncodingHeader) + 2 * board_bytes(board_size);
+}
+
+/**
+ * Write the words of a bitset as little-endian bytes.
+ * @param bitset Bitset to write.
+ * @param buffer Buffer to write to.
+ * @param num_bytes Number of bytes to write, at most the size of the words.
+ */
+static void write_bits(const BitSet* bitset, uint8_t* buffer, const size_t num_bytes) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(buffer, bitset->bits, num_bytes);
+#else
+    for (size_t i = 0; i < num_bytes; i++) {
+        buffer[i] = (uint8_t)(bitset->bits[i / 8] >> (i % 8 * 8));
+    }
+#endif
+}
+
+/**
+ * Read the words of a bitset from little-endian bytes. The words past the bytes are cleared.
+ * @param bitset Bitset to overwrite.
+ * @param buffer Buffer to read from.
+ * @param num_bytes Number of bytes to read.
+ */
+static void read_bits(const BitSet* bitset, const uint8_t* buffer, const size_t num_bytes) {
+    memset(bitset->bits, 0, bitset_num_words(bitset->size) * sizeof(uint64_t));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(bitset->bits, buffer, num_bytes);
+#else
+    for (size_t i = 0; i < num_bytes; i++) {
+        bitset->bits[i / 8] |= (uint64_t)buffer[i] << (i % 8 * 8);
+    }
+#endif
+}
+
+/**
+ * Compute the Zobrist hash from the set bits of the boards, so only the marked tiles are visited.
+ */
+static uint64_t hash_from_bits(const Game* game) {
+    const size_t num_words = bitset_num_words(game->board->player_one_board->size);
+    uint64_t hash = game_zobrist_board_key(game->board->board_size);
+    if (game->current_player == O) {
+        hash ^= GAME_ZOBRIST_SIDE_KEY;
+    }
+
+    for (size_t i = 0; i < num_words; i++) {
+        uint64_t one = game->board->player_one_board->bits[i];
+        uint64_t two = game->board->player_two_board->bits[i];
+
+        while (one != 0) {
+            hash ^= game_zobrist_key(i * 64 + __builtin_ctzll(one), X);
+            one &= one - 1; // clear the lowest set bit
+        }
+        while (two != 0) {
+            hash ^= game_zobrist_key(i * 64 + __builtin_ctzll(two), O);
+            two &= two - 1;
+        }
+    }
+
+    return hash;
+}
+
+size_t game_encode(const Game* game, uint8_t* buffer) {
+    if (game == NULL || buffer == NULL) {
+        throw_err("game_encode", "Game and buffer cannot be NULL.");
+    }
+
+    const uint8_t board_size = game->board->board_size;
+    const size_t num_bytes = board_bytes(board_size);
+
+    const GameEncodingHeader header = {
+        .version = GAME_ENCODING_VERSION,
+        .board_size = board_size,
+        .turns_taken = {(uint8_t)game->turns_taken, (uint8_t)(game->turns_taken >> 8)},
+        .last_x = game->last_x,
+        .last_y = game->last_y,
+        .current_player = (uint8_t)game->current_player,
+    };
+    memcpy(buffer, &header, sizeof(header));
+
+    uint8_t* tiles = buffer + sizeof(header);
+    write_bits(game->board->player_one_board, tiles, num_bytes);
+    write_bits(game->board->player_two_board, tiles + num_bytes, num_bytes);
+
+    return sizeof(header) + 2 * num_bytes;
+}
+
+bool game_encoding_verify(const uint8_t* buffer) {
+    GameEncodingHeader header;
+    memcpy(&header, buffer, sizeof(header));
+
+    const uint8_t board_size = header.board_size;
+    const uint16_t num_tiles = board_size * board_size;
+    const uint16_t turns_taken = header.turns_taken[0] | header.turns_taken[1] << 8;
+
+    if (header.version != GAME_ENCODING_VERSION || board_size == 0 ||
+        (header.current_player != X && header.current_player != O) || header.last_x >= board_size ||
+        header.last_y >= board_size) {
+        return false;
+    }
+
+    const size_t num_bytes = board_bytes(board_size);
+    const uint8_t* tiles_one = buffer + sizeof(header);
+    const uint8_t* tiles_two = tiles_one + num_bytes;
+
+    // no tile can be marked twice and the padding bits of the last byte have to be 0
+    uint8_t invalid = 0;
+    uint16_t count_one = 0;
+    uint16_t count_two = 0;
+    for (size_t i = 0; i < num_bytes; i++) {
+        invalid |= tiles_one[i] & tiles_two[i];
+        count_one += __builtin_popcount(tiles_one[i]);
+        count_two += __builtin_popcount(tiles_two[i]);
+    }
+    if (num_tiles % 8 != 0) {
+        invalid |= (tiles_one[num_bytes - 1] | tiles_two[num_bytes - 1]) & ~((1u << num_tiles % 8) - 1);
+    }
+    if (invalid != 0) {
+        return false;
+    }
+
+    // X starts, so X has as many marks as O when it's to move and one more when O is
+    const uint16_t expected_one = header.current_player == X ? count_two : count_two + 1;
+    if (count_one + count_two != turns_taken || count_one != expected_one) {
+        return false;
+    }
+
+    // game_un_move without a history resets the last move to (0, 0), so that tile can hold anything
+    if (turns_taken > 0 && (header.last_x != 0 || header.last_y != 0)) {
+        const uint16_t last = header.last_y * board_size + header.last_x;
+        const uint8_t* last_tiles = header.current_player == X ? tiles_two : tiles_one;
+        if ((last_tiles[last / 8] >> last % 8 & 1) == 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void game_decode(Game* target, const uint8_t* buffer) {
+    if (target == NULL || buffer == NULL) {
+        throw_err("game_decode", "Target and buffer cannot be NULL.");
+    }
+
+    GameEncodingHeader header;
+    memcpy(&header, buffer, sizeof(header));
+
+    const uint8_t board_size = target->board->board_size;
+
+    if (header.version != GAME_ENCODING_VERSION) {
+        throw_err("game_decode", "Position is encoded with version %d, expected %d.", header.version,
+                  GAME_ENCODING_VERSION);
+    }
+    if (header.board_size != board_size) {
+        throw_err("game_decode", "Position has board size %d, but the target has %d.", header.board_size, board_size);
+    }
+    if (!game_encoding_verify(buffer)) {
+        throw_err("game_decode", "Position is corrupted.");
+    }
+
+    const size_t num_bytes = board_bytes(board_size);
+    const uint8_t* tiles = buffer + sizeof(header);
+    read_bits(target->board->player_one_board, tiles, num_bytes);
+    read_bits(target->board->player_two_board, tiles + num_bytes, num_bytes);
+
+    target->turns_taken = header.turns_taken[0] | header.turns_taken[1] << 8;
+    target->last_x = header.last_x;
+    target->last_y = header.last_y;
+    target->current_player = (PlayerMark)header.current_player;
+    target->hash = hash_from_bits(target);
+    // the recorded moves don't lead to the decoded position
+    target->history_length = 0;
+}
+
+size_t game_encode_batch(const Game* const* games, const size_t count, uint8_t* buffer) {
+    if (count == 0) {
+        return 0;
+    }
+
+    if (games == NULL || buffer == NULL) {
+        throw_err("game_encode_batch", "Games and buffer cannot be NULL.");
+    }
+
+    const uint8_t board_size = games[0]->board->board_size;
+    const size_t record_size = game_encoded_size(board_size);
+
+    for (size_t i = 0; i < count; i++) {
+        if (games[i]->board->board_size != board_size) {
+            throw_err("game_encode_batch", "All games must have the same board size.");
+        }
+
+        game_encode(games[i], buffer + i * record_size);
+    }
+
+    return count * record_size;
+}
+
+void game_decode_batch(Game* const* targets, const size_t count, const uint8_t* buffer) {
+    if (count == 0) {
+        return;
+    }
+
+    if (targets == NULL || buffer == NULL) {
+        throw_err("game_decode_batch", "Targets and buffer cannot be NULL.");
+    }
+
+    const size_t record_size = game_encoded_size(targets[0]->board->board_size);
+
+    // game_decode rejects targets of a different board size than their record
+    for (size_t i = 0; i < count; i++) {
+        game_decode(targets[i], buffer + i * record_size);
+    }
+}
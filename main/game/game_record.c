@@ -0,0 +1,311 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "game_record.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+static const char GAME_RECORD_MAGIC[8] = "OXOXLOG";
+
+_Static_assert(sizeof(GameRecordFileHeader) == 16, "Game log header must not contain padding.");
+_Static_assert(sizeof(GameRecordHeader) == 8, "Game record header must not contain padding.");
+
+/**
+ * Return the number of bytes of one encoded tile on a board size.
+ */
+static uint8_t tile_bytes(const uint8_t board_size) {
+    return board_size * board_size <= 256 ? 1 : 2;
+}
+
+/**
+ * Continue an FNV-1a hash with a block of bytes.
+ */
+static uint32_t fnv1a(uint32_t hash, const uint8_t* bytes, const size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Compute the checksum of a record from its header (without the checksum field) and its tiles.
+ */
+static uint32_t record_checksum(const uint8_t num_moves[2], const int8_t result, const uint8_t* tiles,
+                                const size_t tiles_length) {
+    const uint8_t fields[3] = {num_moves[0], num_moves[1], (uint8_t)result};
+    return fnv1a(fnv1a(2166136261u, fields, sizeof(fields)), tiles, tiles_length);
+}
+
+GameRecordWriter* game_record_writer_open(const char* path, const uint8_t board_size) {
+    if (board_size == 0) {
+        throw_err("game_record_writer_open", "Board size cannot be 0.");
+    }
+
+    // an existing log has to be checked and its torn last record removed before appending to it
+    struct stat file_stat;
+    const bool exists = stat(path, &file_stat) == 0 && file_stat.st_size > 0;
+    if (exists) {
+        GameRecordReader* reader = game_record_reader_open(path);
+        if (reader->board_size != board_size) {
+            throw_err("game_record_writer_open", "Log %s has board size %d, not %d.", path, reader->board_size,
+                      board_size);
+        }
+
+        GameRecord record;
+        while (game_record_next(reader, &record)) {}
+
+        if (reader->truncated && truncate(path, reader->cursor - (const uint8_t*)reader->mapping) != 0) {
+            throw_err("game_record_writer_open", "Couldn't remove the incomplete record from %s.", path);
+        }
+        game_record_reader_close(reader);
+    }
+
+    FILE* file = fopen(path, "ab");
+    if (file == NULL) {
+        throw_err("game_record_writer_open", "Couldn't open the file %s.", path);
+        return NULL;
+    }
+
+    if (!exists) {
+        GameRecordFileHeader header = {0};
+        memcpy(header.magic, GAME_RECORD_MAGIC, sizeof(header.magic));
+        header.version = GAME_RECORD_VERSION;
+        header.board_size = board_size;
+
+        if (fwrite(&header, sizeof(header), 1, file) != 1) {
+            throw_err("game_record_writer_open", "Couldn't write the header to %s.", path);
+        }
+    }
+
+    GameRecordWriter* writer = malloc(sizeof(GameRecordWriter));
+    if (writer == NULL) {
+        throw_err("game_record_writer_open", "Couldn't allocate memory for a game log writer.");
+        return NULL;
+    }
+
+    // the buffer holds at least one record of the longest possible game
+    const uint16_t num_tiles = board_size * board_size;
+    const size_t max_record_size = sizeof(GameRecordHeader) + (size_t)num_tiles * tile_bytes(board_size);
+    writer->buffer_capacity = max_record_size > GAME_RECORD_BUFFER_SIZE ? max_record_size : GAME_RECORD_BUFFER_SIZE;
+    writer->buffer = malloc(writer->buffer_capacity);
+    if (writer->buffer == NULL) {
+        throw_err("game_record_writer_open", "Couldn't allocate memory for the write buffer.");
+    }
+
+    writer->file = file;
+    writer->buffer_used = 0;
+    writer->seen_tiles = bitset_create(num_tiles);
+    writer->board_size = board_size;
+    return writer;
+}
+
+void game_record_write(GameRecordWriter* writer, const uint16_t* tiles, const uint16_t num_moves,
+                       const int8_t result) {
+    const uint16_t num_tiles = writer->board_size * writer->board_size;
+
+    if (num_moves > num_tiles) {
+        throw_err("game_record_write", "A game can't have more moves than tiles.");
+    }
+    if (result < -1 || result > 1) {
+        throw_err("game_record_write", "Result must be -1, 0 or 1.");
+    }
+
+    const uint8_t width = tile_bytes(writer->board_size);
+    const size_t tiles_length = (size_t)num_moves * width;
+    if (writer->buffer_used + sizeof(GameRecordHeader) + tiles_length > writer->buffer_capacity) {
+        game_record_writer_flush(writer);
+    }
+
+    // encode the tiles right into the buffer, checking them on the way
+    uint8_t* encoded = writer->buffer + writer->buffer_used + sizeof(GameRecordHeader);
+    memset(writer->seen_tiles->bits, 0, bitset_num_words(num_tiles) * sizeof(uint64_t));
+    for (uint16_t i = 0; i < num_moves; i++) {
+        const uint16_t tile = tiles[i];
+        if (tile >= num_tiles || bitset_get_unchecked(writer->seen_tiles, tile)) {
+            throw_err("game_record_write", "Move %d is off the board or on an occupied tile.", i);
+        }
+        bitset_set_unchecked(writer->seen_tiles, tile);
+
+        encoded[i * width] = (uint8_t)tile;
+        if (width == 2) {
+            encoded[i * width + 1] = (uint8_t)(tile >> 8);
+        }
+    }
+
+    GameRecordHeader header = {
+        .num_moves = {(uint8_t)num_moves, (uint8_t)(num_moves >> 8)},
+        .result = result,
+    };
+    const uint32_t checksum = record_checksum(header.num_moves, result, encoded, tiles_length);
+    for (uint8_t i = 0; i < 4; i++) {
+        header.checksum[i] = (uint8_t)(checksum >> (i * 8));
+    }
+
+    memcpy(writer->buffer + writer->buffer_used, &header, sizeof(header));
+    writer->buffer_used += sizeof(header) + tiles_length;
+}
+
+void game_record_writer_flush(GameRecordWriter* writer) {
+    if (writer->buffer_used == 0) {
+        return;
+    }
+
+    if (fwrite(writer->buffer, 1, writer->buffer_used, writer->file) != writer->buffer_used ||
+        fflush(writer->file) != 0) {
+        throw_err("game_record_writer_flush", "Couldn't write the records to the log.");
+    }
+
+    writer->buffer_used = 0;
+}
+
+void game_record_writer_close(GameRecordWriter* writer) {
+    if (writer == NULL) {
+        return;
+    }
+
+    game_record_writer_flush(writer);
+    fclose(writer->file);
+    free(writer->buffer);
+    bitset_free(writer->seen_tiles);
+    free(writer);
+}
+
+GameRecordReader* game_record_reader_open(const char* path) {
+    const int file = open(path, O_RDONLY);
+    if (file < 0) {
+        throw_err("game_record_reader_open", "Couldn't open the file %s.", path);
+    }
+
+    struct stat file_stat;
+    if (fstat(file, &file_stat) != 0 || (size_t)file_stat.st_size < sizeof(GameRecordFileHeader)) {
+        throw_err("game_record_reader_open", "File %s is not a game log.", path);
+    }
+
+    const size_t mapped_size = file_stat.st_size;
+    void* mapping = mmap(NULL, mapped_size, PROT_READ, MAP_SHARED, file, 0);
+    // the mapping stays valid after the file is closed
+    close(file);
+
+    if (mapping == MAP_FAILED) {
+        throw_err("game_record_reader_open", "Couldn't map the file %s into memory.", path);
+    }
+
+    // the records are read front to back, so the OS can read ahead aggressively
+    madvise(mapping, mapped_size, MADV_SEQUENTIAL);
+
+    const GameRecordFileHeader* header = mapping;
+    if (memcmp(header->magic, GAME_RECORD_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != GAME_RECORD_VERSION || header->board_size == 0) {
+        throw_err("game_record_reader_open", "File %s is not a game log of version %d.", path, GAME_RECORD_VERSION);
+    }
+
+    GameRecordReader* reader = malloc(sizeof(GameRecordReader));
+    if (reader == NULL) {
+        throw_err("game_record_reader_open", "Couldn't allocate memory for a game log reader.");
+        return NULL;
+    }
+
+    reader->mapping = mapping;
+    reader->mapped_size = mapped_size;
+    reader->cursor = (const uint8_t*)mapping + sizeof(GameRecordFileHeader);
+    reader->end = (const uint8_t*)mapping + mapped_size;
+    reader->truncated = false;
+    reader->board_size = header->board_size;
+    return reader;
+}
+
+bool game_record_next(GameRecordReader* reader, GameRecord* record) {
+    const size_t remaining = reader->end - reader->cursor;
+    if (remaining == 0) {
+        return false;
+    }
+
+    GameRecordHeader header;
+    if (remaining < sizeof(header)) {
+        reader->truncated = true;
+        return false;
+    }
+    memcpy(&header, reader->cursor, sizeof(header));
+
+    const uint8_t width = tile_bytes(reader->board_size);
+    const uint16_t num_moves = header.num_moves[0] | header.num_moves[1] << 8;
+    const size_t record_size = sizeof(header) + (size_t)num_moves * width;
+    if (remaining < record_size) {
+        reader->truncated = true;
+        return false;
+    }
+
+    record->tiles = reader->cursor + sizeof(header);
+    record->num_moves = num_moves;
+    record->result = header.result;
+    record->board_size = reader->board_size;
+    record->checksum = header.checksum[0] | header.checksum[1] << 8 | header.checksum[2] << 16 |
+                       (uint32_t)header.checksum[3] << 24;
+
+    reader->cursor += record_size;
+    return true;
+}
+
+void game_record_reader_close(GameRecordReader* reader) {
+    if (reader == NULL) {
+        return;
+    }
+
+    munmap(reader->mapping, reader->mapped_size);
+    free(reader);
+}
+
+uint16_t game_record_tile(const GameRecord* record, const uint16_t index) {
+    if (tile_bytes(record->board_size) == 1) {
+        return record->tiles[index];
+    }
+
+    return record->tiles[index * 2] | record->tiles[index * 2 + 1] << 8;
+}
+
+bool game_record_verify(const GameRecord* record) {
+    const uint8_t num_moves[2] = {(uint8_t)record->num_moves, (uint8_t)(record->num_moves >> 8)};
+    const size_t tiles_length = (size_t)record->num_moves * tile_bytes(record->board_size);
+    return record_checksum(num_moves, record->result, record->tiles, tiles_length) == record->checksum;
+}
+
+void game_record_replay(Game* game, const GameRecord* record, const uint16_t num_moves) {
+    const uint8_t board_size = game->board->board_size;
+
+    if (num_moves > record->num_moves) {
+        throw_err("game_record_replay", "Record only has %d moves.", record->num_moves);
+    }
+    if (record->board_size != board_size) {
+        throw_err("game_record_replay", "Record comes from a log of board size %d, not %d.", record->board_size,
+                  board_size);
+    }
+    if (!game_record_verify(record)) {
+        throw_err("game_record_replay", "Record doesn't match its checksum.");
+    }
+
+    // start from the empty board
+    const size_t num_words = bitset_num_words(game->board->player_one_board->size);
+    memset(game->board->player_one_board->bits, 0, num_words * sizeof(uint64_t));
+    memset(game->board->player_two_board->bits, 0, num_words * sizeof(uint64_t));
+    game->turns_taken = 0;
+    game->last_x = 0;
+    game->last_y = 0;
+    game->current_player = X;
+    game->hash = game_zobrist_board_key(board_size);
+    game->history_length = 0;
+
+    // the writer rejected records with tiles off the board or played twice
+    for (uint16_t i = 0; i < num_moves; i++) {
+        const uint16_t tile = game_record_tile(record, i);
+        game_move_unchecked(game, tile % board_size, tile / board_size);
+    }
+}
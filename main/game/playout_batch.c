@@ -0,0 +1,267 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "playout_batch.h"
+
+#include "bitboard.h"
+#include "utils/functions/stat_counters.h"
+#include "utils/functions/std_utils.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define PLAYOUT_BATCH_X86
+#endif
+
+// pattern search over all the lanes, writes the pattern starts of every lane (in any direction) to patterns
+typedef void (*FindPatternsKernel)(PlayoutBatch* batch, const uint64_t edge_masks[NUM_LINE_DIRECTIONS],
+                                   const uint8_t steps[NUM_LINE_DIRECTIONS]);
+
+/**
+ * Portable kernel, one lane at a time (compilers may still vectorize the loop).
+ */
+static void find_patterns_scalar(PlayoutBatch* batch, const uint64_t edge_masks[NUM_LINE_DIRECTIONS],
+                                 const uint8_t steps[NUM_LINE_DIRECTIONS]) {
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+        const uint64_t x = batch->player_one_board[lane];
+        const uint64_t o = batch->player_two_board[lane];
+        uint64_t found = 0;
+
+        for (uint8_t direction = 0; direction < NUM_LINE_DIRECTIONS; direction++) {
+            const uint8_t step = steps[direction];
+            const uint64_t xox = x & o >> step & x >> 2 * step;
+            const uint64_t oxo = o & x >> step & o >> 2 * step;
+            found |= (xox | oxo) & edge_masks[direction];
+        }
+
+        batch->patterns[lane] = found;
+    }
+}
+
+#ifdef PLAYOUT_BATCH_X86
+/**
+ * SSE2 kernel, 2 lanes per instruction (SSE2 is part of every x86-64 CPU).
+ */
+static void find_patterns_sse2(PlayoutBatch* batch, const uint64_t edge_masks[NUM_LINE_DIRECTIONS],
+                               const uint8_t steps[NUM_LINE_DIRECTIONS]) {
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane += 2) {
+        const __m128i x = _mm_load_si128((const __m128i*)&batch->player_one_board[lane]);
+        const __m128i o = _mm_load_si128((const __m128i*)&batch->player_two_board[lane]);
+        __m128i found = _mm_setzero_si128();
+
+        for (uint8_t direction = 0; direction < NUM_LINE_DIRECTIONS; direction++) {
+            const __m128i once = _mm_cvtsi32_si128(steps[direction]);
+            const __m128i twice = _mm_cvtsi32_si128(2 * steps[direction]);
+            const __m128i xox = _mm_and_si128(_mm_and_si128(x, _mm_srl_epi64(o, once)), _mm_srl_epi64(x, twice));
+            const __m128i oxo = _mm_and_si128(_mm_and_si128(o, _mm_srl_epi64(x, once)), _mm_srl_epi64(o, twice));
+            const __m128i edge_mask = _mm_set1_epi64x((long long)edge_masks[direction]);
+            found = _mm_or_si128(found, _mm_and_si128(_mm_or_si128(xox, oxo), edge_mask));
+        }
+
+        _mm_store_si128((__m128i*)&batch->patterns[lane], found);
+    }
+}
+
+/**
+ * AVX2 kernel, 4 lanes per instruction. Compiled for AVX2 regardless of the build flags and only called when the CPU
+ * supports it.
+ */
+__attribute__((target("avx2"))) static void find_patterns_avx2(PlayoutBatch* batch,
+                                                               const uint64_t edge_masks[NUM_LINE_DIRECTIONS],
+                                                               const uint8_t steps[NUM_LINE_DIRECTIONS]) {
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane += 4) {
+        const __m256i x = _mm256_load_si256((const __m256i*)&batch->player_one_board[lane]);
+        const __m256i o = _mm256_load_si256((const __m256i*)&batch->player_two_board[lane]);
+        __m256i found = _mm256_setzero_si256();
+
+        for (uint8_t direction = 0; direction < NUM_LINE_DIRECTIONS; direction++) {
+            const __m128i once = _mm_cvtsi32_si128(steps[direction]);
+            const __m128i twice = _mm_cvtsi32_si128(2 * steps[direction]);
+            const __m256i xox =
+                _mm256_and_si256(_mm256_and_si256(x, _mm256_srl_epi64(o, once)), _mm256_srl_epi64(x, twice));
+            const __m256i oxo =
+                _mm256_and_si256(_mm256_and_si256(o, _mm256_srl_epi64(x, once)), _mm256_srl_epi64(o, twice));
+            const __m256i edge_mask = _mm256_set1_epi64x((long long)edge_masks[direction]);
+            found = _mm256_or_si256(found, _mm256_and_si256(_mm256_or_si256(xox, oxo), edge_mask));
+        }
+
+        _mm256_store_si256((__m256i*)&batch->patterns[lane], found);
+    }
+}
+#endif
+
+/**
+ * Return the index of the n-th (from 0) set bit of a word.
+ * @param word Word with more than rank set bits.
+ * @param rank Number of set bits to skip.
+ * @return Index of the bit.
+ */
+static inline uint8_t select_bit(uint64_t word, uint32_t rank) {
+    uint8_t offset = 0;
+
+    // narrow down to the byte with the target by halving, then skip the bits below it
+    for (uint8_t width = 32; width >= 8; width /= 2) {
+        const uint64_t low_mask = ((uint64_t)1 << width) - 1;
+        const uint32_t count = __builtin_popcountll(word & low_mask);
+        if (rank >= count) {
+            rank -= count;
+            word >>= width;
+            offset += width;
+        }
+    }
+
+    while (rank-- > 0) {
+        word &= word - 1;
+    }
+
+    return offset + __builtin_ctzll(word);
+}
+
+// one random move in every active lane, all the lanes have the same number of empty tiles
+typedef void (*PlayMovesKernel)(PlayoutBatch* batch, uint64_t* mover_boards, const bool* active, uint64_t board_mask,
+                                uint32_t num_empty, Rng* rng);
+
+/**
+ * Portable kernel, selects the drawn empty tile with popcounts.
+ */
+static void play_moves_generic(PlayoutBatch* batch, uint64_t* mover_boards, const bool* active,
+                               const uint64_t board_mask, const uint32_t num_empty, Rng* rng) {
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+        if (active[lane]) {
+            const uint64_t empty = ~(batch->player_one_board[lane] | batch->player_two_board[lane]) & board_mask;
+            mover_boards[lane] |= (uint64_t)1 << select_bit(empty, rng_below(rng, num_empty));
+        }
+    }
+}
+
+#ifdef PLAYOUT_BATCH_X86
+/**
+ * BMI2 kernel, deposits a single bit into the drawn empty tile with one PDEP instruction.
+ */
+__attribute__((target("bmi2"))) static void play_moves_bmi2(PlayoutBatch* batch, uint64_t* mover_boards,
+                                                            const bool* active, const uint64_t board_mask,
+                                                            const uint32_t num_empty, Rng* rng) {
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+        if (active[lane]) {
+            const uint64_t empty = ~(batch->player_one_board[lane] | batch->player_two_board[lane]) & board_mask;
+            mover_boards[lane] |= _pdep_u64((uint64_t)1 << rng_below(rng, num_empty), empty);
+        }
+    }
+}
+#endif
+
+static FindPatternsKernel find_patterns_kernel = find_patterns_scalar;
+static PlayMovesKernel play_moves_kernel = play_moves_generic;
+
+// runs once when the library is loaded, picks the widest kernels the CPU supports
+__attribute__((constructor)) static void playout_batch_select_kernels(void) {
+#ifdef PLAYOUT_BATCH_X86
+    __builtin_cpu_init();
+    find_patterns_kernel = __builtin_cpu_supports("avx2") ? find_patterns_avx2 : find_patterns_sse2;
+    if (__builtin_cpu_supports("bmi2")) {
+        play_moves_kernel = play_moves_bmi2;
+    }
+#endif
+}
+
+int playout_batch_run(PlayoutBatch* batch, const Game* position, const uint8_t num_lanes, Rng* rng) {
+    if (batch == NULL || position == NULL || rng == NULL) {
+        throw_err("playout_batch_run", "Batch, position and generator cannot be NULL.");
+    }
+
+    const uint8_t board_size = position->board->board_size;
+    if (board_size > PLAYOUT_BATCH_MAX_SIZE) {
+        throw_err("playout_batch_run", "Board size %d doesn't fit into a batch (maximum is %d).", board_size,
+                  PLAYOUT_BATCH_MAX_SIZE);
+    }
+
+    if (num_lanes == 0 || num_lanes > PLAYOUT_BATCH_LANES) {
+        throw_err("playout_batch_run", "Number of lanes must be between 1 and %d.", PLAYOUT_BATCH_LANES);
+    }
+
+    const BitBoard start = bitboard_from_board(position->board);
+    const uint16_t num_tiles = board_size * board_size;
+    const uint16_t num_empty = num_tiles - bitboard_count_occupied(&start);
+    const uint64_t board_mask = num_tiles == 64 ? UINT64_MAX : ((uint64_t)1 << num_tiles) - 1;
+
+    // an already won position is lost for the player to move, like in game_random_play
+    if (bitboard_is_win(&start)) {
+        for (uint8_t lane = 0; lane < num_lanes; lane++) {
+            batch->results[lane] = -1;
+            stats_record_playout(0, -1);
+        }
+        return -num_lanes;
+    }
+
+    uint64_t edge_masks[NUM_LINE_DIRECTIONS] = {0};
+    uint8_t steps[NUM_LINE_DIRECTIONS] = {1, 1, 1, 1};
+    if (board_size >= 3) {
+        const uint8_t direction_steps[NUM_LINE_DIRECTIONS] = {1, board_size, board_size + 1, board_size - 1};
+        for (uint8_t direction = 0; direction < NUM_LINE_DIRECTIONS; direction++) {
+            edge_masks[direction] = bitboard_edge_mask(board_size, direction)[0];
+            steps[direction] = direction_steps[direction];
+        }
+    }
+
+    // unused lanes start finished, they're still processed by the kernel but never get a move
+    bool active[PLAYOUT_BATCH_LANES];
+    uint8_t num_active = num_lanes;
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+        batch->player_one_board[lane] = start.player_one_board[0];
+        batch->player_two_board[lane] = start.player_two_board[0];
+        batch->results[lane] = 0;
+        active[lane] = lane < num_lanes;
+    }
+
+    PlayerMark player = position->current_player;
+
+    for (uint16_t step = 0; step < num_empty && num_active > 0; step++) {
+        // all the active lanes have the same number of empty tiles, so the draw range is shared
+        const uint32_t remaining = num_empty - step;
+        uint64_t* mover_boards = player == X ? batch->player_one_board : batch->player_two_board;
+
+        play_moves_kernel(batch, mover_boards, active, board_mask, remaining, rng);
+        find_patterns_kernel(batch, edge_masks, steps);
+
+        // a pattern can only appear after the player's move, so the player won
+        for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+            if (active[lane] && batch->patterns[lane] != 0) {
+                batch->results[lane] = player == position->current_player ? 1 : -1;
+                active[lane] = false;
+                stats_record_playout(step + 1, batch->results[lane]);
+                num_active--;
+            }
+        }
+
+        player = player == X ? O : X;
+    }
+
+    // the lanes that are still active filled the board without a pattern
+    int result_sum = 0;
+    for (uint8_t lane = 0; lane < num_lanes; lane++) {
+        result_sum += batch->results[lane];
+        if (active[lane]) {
+            stats_record_playout(num_empty, 0);
+        }
+    }
+
+    return result_sum;
+}
+
+float game_rollout_batch(const Game* position, const unsigned int num_iterations, Rng* rng) {
+    if (position == NULL || rng == NULL) {
+        throw_err("game_rollout_batch", "Position and generator cannot be NULL.");
+        return 0.0f;
+    }
+
+    PlayoutBatch batch;
+    long long score_sum = 0;
+
+    for (unsigned int i = 0; i < num_iterations; i += PLAYOUT_BATCH_LANES) {
+        const unsigned int num_lanes = num_iterations - i < PLAYOUT_BATCH_LANES ? num_iterations - i
+                                                                                : PLAYOUT_BATCH_LANES;
+        score_sum += playout_batch_run(&batch, position, num_lanes, rng);
+    }
+
+    return (float)score_sum / (float)num_iterations;
+}
@@ -0,0 +1,187 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "symmetry.h"
+
+#include "utils/functions/std_utils.h"
+
+#define SYMMETRY_MAX_TILES (BITBOARD_MAX_SIZE * BITBOARD_MAX_SIZE)
+
+_Static_assert(SYMMETRY_MAX_TILES <= 256, "Transformed tiles of a bitboard must fit into a byte.");
+
+// where every symmetry moves every tile of the bitboard sizes, indexed by [board_size][BoardSymmetry][tile]
+static uint8_t TILE_MAPS[BITBOARD_MAX_SIZE + 1][NUM_SYMMETRIES][SYMMETRY_MAX_TILES];
+
+uint16_t symmetry_transform_tile(const uint8_t board_size, const uint16_t tile, const BoardSymmetry symmetry) {
+    const uint8_t x = tile % board_size;
+    const uint8_t y = tile / board_size;
+    const uint8_t n = board_size - 1;
+
+    switch (symmetry) {
+        case SYMMETRY_IDENTITY:
+            return tile;
+        case SYMMETRY_ROTATE_90:
+            return x * board_size + (n - y);
+        case SYMMETRY_ROTATE_180:
+            return (n - y) * board_size + (n - x);
+        case SYMMETRY_ROTATE_270:
+            return (n - x) * board_size + y;
+        case SYMMETRY_FLIP_HORIZONTAL:
+            return y * board_size + (n - x);
+        case SYMMETRY_FLIP_VERTICAL:
+            return (n - y) * board_size + x;
+        case SYMMETRY_TRANSPOSE:
+            return x * board_size + y;
+        case SYMMETRY_ANTI_TRANSPOSE:
+            return (n - x) * board_size + (n - y);
+    }
+
+    throw_err("symmetry_transform_tile", "Unknown symmetry %d.", symmetry);
+    return tile;
+}
+
+BoardSymmetry symmetry_inverse(const BoardSymmetry symmetry) {
+    // the two quarter turns undo each other, everything else is its own inverse
+    if (symmetry == SYMMETRY_ROTATE_90) {
+        return SYMMETRY_ROTATE_270;
+    }
+    if (symmetry == SYMMETRY_ROTATE_270) {
+        return SYMMETRY_ROTATE_90;
+    }
+    return symmetry;
+}
+
+// runs once when the library is loaded, so the tables are ready before any (possibly multithreaded) use
+__attribute__((constructor)) static void symmetry_init_tile_maps(void) {
+    for (uint8_t size = 1; size <= BITBOARD_MAX_SIZE; size++) {
+        for (uint8_t symmetry = 0; symmetry < NUM_SYMMETRIES; symmetry++) {
+            for (uint16_t tile = 0; tile < size * size; tile++) {
+                TILE_MAPS[size][symmetry][tile] = symmetry_transform_tile(size, tile, symmetry);
+            }
+        }
+    }
+}
+
+/**
+ * Move the set bits of a word array to their transformed tiles.
+ * @param output Array to write to, must be cleared.
+ * @param input Array to transform.
+ * @param map Tile map of the symmetry.
+ * @param num_words Number of words in the arrays.
+ */
+static inline void transform_words(uint64_t* output, const uint64_t* input, const uint8_t* map,
+                                   const uint8_t num_words) {
+    for (uint8_t i = 0; i < num_words; i++) {
+        uint64_t word = input[i];
+        while (word != 0) {
+            const uint8_t tile = map[i * 64 + __builtin_ctzll(word)];
+            output[tile / 64] |= (uint64_t)1 << (tile % 64);
+            word &= word - 1; // clear the lowest set bit
+        }
+    }
+}
+
+BitBoard bitboard_transform(const BitBoard* bitboard, const BoardSymmetry symmetry) {
+    if (symmetry >= NUM_SYMMETRIES) {
+        throw_err("bitboard_transform", "Unknown symmetry %d.", symmetry);
+    }
+
+    BitBoard result = bitboard_create(bitboard->board_size);
+    const uint8_t* map = TILE_MAPS[bitboard->board_size][symmetry];
+    transform_words(result.player_one_board, bitboard->player_one_board, map, bitboard->num_words);
+    transform_words(result.player_two_board, bitboard->player_two_board, map, bitboard->num_words);
+    return result;
+}
+
+/**
+ * Compare two positions of the same size in the order used for canonicalization.
+ * @return Negative if the first one is smaller, 0 if they're equal, positive otherwise.
+ */
+static int compare_positions(const BitBoard* first, const BitBoard* second) {
+    for (int i = first->num_words - 1; i >= 0; i--) {
+        if (first->player_one_board[i] != second->player_one_board[i]) {
+            return first->player_one_board[i] < second->player_one_board[i] ? -1 : 1;
+        }
+    }
+    for (int i = first->num_words - 1; i >= 0; i--) {
+        if (first->player_two_board[i] != second->player_two_board[i]) {
+            return first->player_two_board[i] < second->player_two_board[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+BoardSymmetry bitboard_canonicalize(const BitBoard* bitboard, BitBoard* canonical) {
+    BoardSymmetry best_symmetry = SYMMETRY_IDENTITY;
+    *canonical = *bitboard;
+
+    for (uint8_t symmetry = 1; symmetry < NUM_SYMMETRIES; symmetry++) {
+        const BitBoard transformed = bitboard_transform(bitboard, symmetry);
+        if (compare_positions(&transformed, canonical) < 0) {
+            *canonical = transformed;
+            best_symmetry = symmetry;
+        }
+    }
+
+    return best_symmetry;
+}
+
+BoardSymmetry board_canonicalize(const Board* board, const Board* canonical) {
+    if (board == NULL || canonical == NULL) {
+        throw_err("board_canonicalize", "Boards cannot be NULL.");
+    }
+
+    const BitBoard bitboard = bitboard_from_board(board);
+    BitBoard result;
+    const BoardSymmetry symmetry = bitboard_canonicalize(&bitboard, &result);
+    bitboard_to_board(&result, canonical);
+    return symmetry;
+}
+
+uint16_t board_get_unique_legal_tiles(uint16_t* tile_buffer, const Board* board) {
+    if (board == NULL || tile_buffer == NULL) {
+        throw_err("board_get_unique_legal_tiles", "Board and buffer cannot be NULL.");
+    }
+
+    const BitBoard bitboard = bitboard_from_board(board);
+    const uint8_t board_size = bitboard.board_size;
+    const uint16_t num_tiles = board_size * board_size;
+
+    // the symmetries that leave the position unchanged
+    const uint8_t* stabilizer[NUM_SYMMETRIES];
+    uint8_t num_stabilizing = 0;
+    for (uint8_t symmetry = 1; symmetry < NUM_SYMMETRIES; symmetry++) {
+        const BitBoard transformed = bitboard_transform(&bitboard, symmetry);
+        if (compare_positions(&transformed, &bitboard) == 0) {
+            stabilizer[num_stabilizing++] = TILE_MAPS[board_size][symmetry];
+        }
+    }
+
+    uint16_t count = 0;
+    for (uint8_t i = 0; i < bitboard.num_words; i++) {
+        uint64_t empty = ~(bitboard.player_one_board[i] | bitboard.player_two_board[i]);
+        if (i == (num_tiles - 1) / 64 && num_tiles % 64 != 0) {
+            empty &= ((uint64_t)1 << num_tiles % 64) - 1;
+        }
+        else if (i > (num_tiles - 1) / 64) {
+            break;
+        }
+
+        while (empty != 0) {
+            const uint16_t tile = i * 64 + __builtin_ctzll(empty);
+            empty &= empty - 1;
+
+            // the tile represents its class if no symmetry of the position maps it to a smaller tile
+            bool smallest = true;
+            for (uint8_t s = 0; s < num_stabilizing && smallest; s++) {
+                smallest = stabilizer[s][tile] >= tile;
+            }
+            if (smallest) {
+                tile_buffer[count++] = tile;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,269 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "game_db.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bitboard.h"
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+static const char GAME_DB_MAGIC[8] = "OXOXDB";
+
+_Static_assert(sizeof(GameDbHeader) == 24, "Game database header must not contain padding.");
+
+/**
+ * Read the 2-bit value of a position from the packed array.
+ */
+static inline GameDbValue get_value(const uint8_t* values, const uint64_t index) {
+    return (GameDbValue)(values[index / 4] >> (index % 4 * 2) & 3);
+}
+
+/**
+ * Write the 2-bit value of a position into the packed array.
+ */
+static inline void set_value(uint8_t* values, const uint64_t index, const GameDbValue value) {
+    const uint8_t shift = index % 4 * 2;
+    values[index / 4] = (uint8_t)((values[index / 4] & ~(3 << shift)) | value << shift);
+}
+
+/**
+ * Add 1 to a base-3 number stored as digits (least significant first).
+ */
+static inline void digits_increment(uint8_t* digits, const uint16_t num_digits) {
+    for (uint16_t i = 0; i < num_digits; i++) {
+        if (++digits[i] < 3) {
+            return;
+        }
+        digits[i] = 0;
+    }
+}
+
+/**
+ * Subtract 1 from a base-3 number stored as digits (least significant first).
+ */
+static inline void digits_decrement(uint8_t* digits, const uint16_t num_digits) {
+    for (uint16_t i = 0; i < num_digits; i++) {
+        if (digits[i]-- > 0) {
+            return;
+        }
+        digits[i] = 2;
+    }
+}
+
+/**
+ * Fill a bitboard from the base-3 digits of a position.
+ * @return Number of marked tiles.
+ */
+static uint16_t digits_to_bitboard(BitBoard* bitboard, const uint8_t* digits, const uint16_t num_digits) {
+    uint16_t num_marked = 0;
+    bitboard->player_one_board[0] = 0;
+    bitboard->player_two_board[0] = 0;
+
+    for (uint16_t i = 0; i < num_digits; i++) {
+        bitboard->player_one_board[0] |= (uint64_t)(digits[i] == X) << i;
+        bitboard->player_two_board[0] |= (uint64_t)(digits[i] == O) << i;
+        num_marked += digits[i] != EMPTY;
+    }
+
+    return num_marked;
+}
+
+uint64_t game_db_index(const Game* game) {
+    if (game->board->board_size > GAME_DB_MAX_SIZE) {
+        throw_err("game_db_index", "Board size %d is too large to index.", game->board->board_size);
+    }
+
+    const uint16_t num_tiles = game->board->board_size * game->board->board_size;
+    uint64_t index = 0;
+
+    // Horner's scheme from the most significant digit
+    for (uint16_t i = num_tiles; i > 0; i--) {
+        index = index * 3 + board_get_index_unchecked(game->board, i - 1);
+    }
+
+    return index;
+}
+
+void game_db_build(const uint8_t board_size, const char* path) {
+    if (board_size == 0 || board_size > GAME_DB_MAX_SIZE) {
+        throw_err("game_db_build", "Board size %d is not supported (1 to %d).", board_size, GAME_DB_MAX_SIZE);
+    }
+
+    const uint16_t num_tiles = board_size * board_size;
+    uint64_t powers[GAME_DB_MAX_SIZE * GAME_DB_MAX_SIZE];
+    uint64_t num_positions = 1;
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        powers[i] = num_positions;
+        num_positions *= 3;
+    }
+
+    const size_t num_bytes = (num_positions + 3) / 4;
+    uint8_t* values = calloc(num_bytes, 1);
+    if (values == NULL) {
+        throw_err("game_db_build", "Couldn't allocate memory for %llu positions.", (unsigned long long)num_positions);
+        return;
+    }
+
+    uint8_t digits[GAME_DB_MAX_SIZE * GAME_DB_MAX_SIZE] = {0};
+    BitBoard bitboard = bitboard_create(board_size);
+
+    // forward pass: mark the positions reachable from the empty board (as draws, the backward pass fixes the value)
+    set_value(values, 0, DB_DRAW);
+    for (uint64_t index = 0; index < num_positions; index++, digits_increment(digits, num_tiles)) {
+        if (get_value(values, index) == DB_UNKNOWN) {
+            continue;
+        }
+
+        const uint16_t num_marked = digits_to_bitboard(&bitboard, digits, num_tiles);
+        if (num_marked == num_tiles || bitboard_is_win(&bitboard)) {
+            continue;
+        }
+
+        // X moves when both players have the same number of marks
+        const PlayerMark player = num_marked % 2 == 0 ? X : O;
+        for (uint16_t i = 0; i < num_tiles; i++) {
+            if (digits[i] == EMPTY) {
+                set_value(values, index + player * powers[i], DB_DRAW);
+            }
+        }
+    }
+
+    // backward pass: the children of a position have higher indices, so they're solved before it
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        digits[i] = 2;
+    }
+    for (uint64_t index = num_positions; index > 0; index--, digits_decrement(digits, num_tiles)) {
+        const uint64_t position = index - 1;
+        if (get_value(values, position) == DB_UNKNOWN) {
+            continue;
+        }
+
+        const uint16_t num_marked = digits_to_bitboard(&bitboard, digits, num_tiles);
+        if (bitboard_is_win(&bitboard)) {
+            set_value(values, position, DB_LOSS);
+            continue;
+        }
+        if (num_marked == num_tiles) {
+            continue;
+        }
+
+        // win if any move leaves the opponent lost, draw if any move leaves them drawn, loss otherwise
+        const PlayerMark player = num_marked % 2 == 0 ? X : O;
+        GameDbValue value = DB_LOSS;
+        for (uint16_t i = 0; i < num_tiles && value != DB_WIN; i++) {
+            if (digits[i] != EMPTY) {
+                continue;
+            }
+
+            const GameDbValue child = get_value(values, position + player * powers[i]);
+            if (child == DB_LOSS) {
+                value = DB_WIN;
+            }
+            else if (child == DB_DRAW) {
+                value = DB_DRAW;
+            }
+        }
+        set_value(values, position, value);
+    }
+
+    GameDbHeader header = {0};
+    memcpy(header.magic, GAME_DB_MAGIC, sizeof(header.magic));
+    header.version = GAME_DB_VERSION;
+    header.board_size = board_size;
+    header.num_positions = num_positions;
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        throw_err("game_db_build", "Couldn't create the file %s.", path);
+        return;
+    }
+
+    if (fwrite(&header, sizeof(header), 1, file) != 1 || fwrite(values, 1, num_bytes, file) != num_bytes) {
+        throw_err("game_db_build", "Couldn't write the database to %s.", path);
+    }
+
+    fclose(file);
+    free(values);
+}
+
+GameDb* game_db_open(const char* path) {
+    const int file = open(path, O_RDONLY);
+    if (file < 0) {
+        throw_err("game_db_open", "Couldn't open the file %s.", path);
+    }
+
+    struct stat file_stat;
+    if (fstat(file, &file_stat) != 0 || (size_t)file_stat.st_size < sizeof(GameDbHeader)) {
+        throw_err("game_db_open", "File %s is not a game database.", path);
+    }
+
+    const size_t mapped_size = file_stat.st_size;
+    void* mapping = mmap(NULL, mapped_size, PROT_READ, MAP_SHARED, file, 0);
+    // the mapping stays valid after the file is closed
+    close(file);
+
+    if (mapping == MAP_FAILED) {
+        throw_err("game_db_open", "Couldn't map the file %s into memory.", path);
+    }
+
+    const GameDbHeader* header = mapping;
+    if (memcmp(header->magic, GAME_DB_MAGIC, sizeof(header->magic)) != 0 || header->version != GAME_DB_VERSION) {
+        throw_err("game_db_open", "File %s is not a game database of version %d.", path, GAME_DB_VERSION);
+    }
+    if (header->board_size == 0 || header->board_size > GAME_DB_MAX_SIZE) {
+        throw_err("game_db_open", "Board size %d of %s is not supported (1 to %d).", header->board_size, path,
+                  GAME_DB_MAX_SIZE);
+    }
+
+    // lookups index the values directly, so the count must be exactly the number of base-3 indices
+    const uint16_t num_tiles = header->board_size * header->board_size;
+    uint64_t num_positions = 1;
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        num_positions *= 3;
+    }
+    if (header->num_positions != num_positions) {
+        throw_err("game_db_open", "File %s doesn't have 3^%d positions.", path, num_tiles);
+    }
+    if (mapped_size < sizeof(GameDbHeader) + (num_positions + 3) / 4) {
+        throw_err("game_db_open", "File %s is truncated.", path);
+    }
+
+    GameDb* db = malloc(sizeof(GameDb));
+    if (db == NULL) {
+        throw_err("game_db_open", "Couldn't allocate memory for a game database.");
+        return NULL;
+    }
+
+    db->mapping = mapping;
+    db->mapped_size = mapped_size;
+    db->values = (const uint8_t*)mapping + sizeof(GameDbHeader);
+    db->num_positions = header->num_positions;
+    db->board_size = header->board_size;
+    return db;
+}
+
+void game_db_close(GameDb* db) {
+    if (db == NULL) {
+        return;
+    }
+
+    munmap(db->mapping, db->mapped_size);
+    free(db);
+}
+
+GameDbValue game_db_lookup(const GameDb* db, const Game* game) {
+    if (game->board->board_size != db->board_size) {
+        throw_err("game_db_lookup", "Game size doesn't match the database.");
+    }
+
+    return get_value(db->values, game_db_index(game));
+}
@@ -0,0 +1,581 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "mcts.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+Mcts* mcts_create(const uint8_t board_size, const uint32_t capacity, const uint64_t seed) {
+    if (capacity == 0) {
+        throw_err("mcts_create", "Node capacity cannot be 0.");
+    }
+
+    Mcts* mcts = malloc(sizeof(Mcts));
+    if (mcts == NULL) {
+        throw_err("mcts_create", "Couldn't allocate memory for a search.");
+        return NULL;
+    }
+
+    const uint16_t num_tiles = board_size * board_size;
+
+    mcts->first_child = malloc(capacity * sizeof(uint32_t));
+    mcts->num_children = malloc(capacity * sizeof(uint16_t));
+    mcts->move = malloc(capacity * sizeof(uint16_t));
+    mcts->visits = malloc(capacity * sizeof(uint32_t));
+    mcts->value_sum = malloc(capacity * sizeof(float));
+    mcts->num_nodes = 0;
+    mcts->capacity = capacity;
+
+    mcts->game = game_create(board_size);
+    mcts->move_buffer = malloc(num_tiles * sizeof(*mcts->move_buffer));
+    mcts->tile_buffer = malloc(num_tiles * sizeof(uint16_t));
+    // the path holds the root and at most one node per tile
+    mcts->path = malloc((num_tiles + 1) * sizeof(uint32_t));
+    rng_seed(&mcts->rng, seed);
+
+    if (mcts->first_child == NULL || mcts->num_children == NULL || mcts->move == NULL || mcts->visits == NULL ||
+        mcts->value_sum == NULL || mcts->move_buffer == NULL || mcts->tile_buffer == NULL || mcts->path == NULL) {
+        throw_err("mcts_create", "Couldn't allocate memory for the search tree.");
+        return NULL;
+    }
+
+    return mcts;
+}
+
+void mcts_free(Mcts* mcts) {
+    if (mcts == NULL) {
+        return;
+    }
+
+    free(mcts->first_child);
+    free(mcts->num_children);
+    free(mcts->move);
+    free(mcts->visits);
+    free(mcts->value_sum);
+    game_free(mcts->game);
+    free(mcts->move_buffer);
+    free(mcts->tile_buffer);
+    free(mcts->path);
+    free(mcts);
+}
+
+/**
+ * Pick the child with the highest UCT score. Children that were never visited are picked first.
+ * @param mcts Search the node belongs to.
+ * @param node Index of an expanded node.
+ * @param exploration UCT exploration constant.
+ * @return Index of the selected child.
+ */
+static uint32_t select_child(const Mcts* mcts, const uint32_t node, const float exploration) {
+    const uint32_t first = mcts->first_child[node];
+    const uint32_t last = first + mcts->num_children[node];
+    const float log_visits = logf((float)mcts->visits[node]);
+
+    uint32_t best_child = first;
+    float best_score = -INFINITY;
+
+    for (uint32_t child = first; child < last; child++) {
+        const uint32_t visits = mcts->visits[child];
+
+        if (visits == 0) {
+            return child;
+        }
+
+        const float score = mcts->value_sum[child] / (float)visits + exploration * sqrtf(log_visits / (float)visits);
+        if (score > best_score) {
+            best_score = score;
+            best_child = child;
+        }
+    }
+
+    return best_child;
+}
+
+/**
+ * Create the children of a node for every legal move of the current position. The children are placed next to each
+ * other at the end of the pool.
+ * @param mcts Search to expand.
+ * @param node Index of the node, the search's game must be in the node's position.
+ * @return True if the node was expanded, false if there are no moves or the pool is full.
+ */
+static bool expand(Mcts* mcts, const uint32_t node) {
+    const uint16_t num_moves = board_get_legal_tiles(mcts->tile_buffer, mcts->game->board);
+
+    if (num_moves == 0 || mcts->num_nodes + num_moves > mcts->capacity) {
+        return false;
+    }
+
+    const uint32_t first = mcts->num_nodes;
+    for (uint16_t i = 0; i < num_moves; i++) {
+        mcts->first_child[first + i] = 0;
+        mcts->num_children[first + i] = 0;
+        mcts->move[first + i] = mcts->tile_buffer[i];
+        mcts->visits[first + i] = 0;
+        mcts->value_sum[first + i] = 0;
+    }
+
+    mcts->first_child[node] = first;
+    mcts->num_children[node] = num_moves;
+    mcts->num_nodes += num_moves;
+
+    return true;
+}
+
+/**
+ * Make the move of a node in a game.
+ * @param game Game to play in.
+ * @param tile Tile index of the node's move.
+ * @param result Output for the result from the perspective of the player who made the move, if the game ended.
+ * @return True if the move ended the game.
+ */
+static bool play_node_move(Game* game, const uint16_t tile, float* result) {
+    const uint8_t board_size = game->board->board_size;
+    game_move_unchecked(game, tile % board_size, tile / board_size);
+
+    if (game_is_win(game)) {
+        *result = 1;
+        return true;
+    }
+
+    if (game_is_tie(game)) {
+        *result = 0;
+        return true;
+    }
+
+    return false;
+}
+
+MctsResult mcts_search(Mcts* mcts, const Game* position, const MctsConfig* config) {
+    if (mcts == NULL || position == NULL || config == NULL) {
+        throw_err("mcts_search", "Search, position and config cannot be NULL.");
+    }
+
+    if (config->max_iterations == 0 && config->max_seconds <= 0) {
+        throw_err("mcts_search", "At least one of the budgets has to be set.");
+    }
+
+    if (position->board->board_size != mcts->game->board->board_size) {
+        throw_err("mcts_search", "Position size doesn't match the search.");
+    }
+
+    if (game_is_win_full(position) || game_is_tie(position)) {
+        throw_err("mcts_search", "Can't search a position where the game already ended.");
+    }
+
+    // start a new tree from the root position
+    mcts->num_nodes = 1;
+    mcts->first_child[0] = 0;
+    mcts->num_children[0] = 0;
+    mcts->visits[0] = 0;
+    mcts->value_sum[0] = 0;
+
+    game_copy_into(mcts->game, position);
+    if (!expand(mcts, 0)) {
+        throw_err("mcts_search", "Node capacity is too small to expand the root.");
+    }
+
+    const double start_time = seconds_now();
+    unsigned int iterations = 0;
+
+    while (config->max_iterations == 0 || iterations < config->max_iterations) {
+        if (config->max_seconds > 0 && seconds_now() - start_time >= config->max_seconds) {
+            break;
+        }
+
+        game_copy_into(mcts->game, position);
+
+        uint32_t node = 0;
+        uint16_t depth = 0;
+        mcts->path[depth++] = node;
+
+        // result from the perspective of the player who made the move into the last node of the path
+        float result = 0;
+        bool game_over = false;
+
+        // selection: descend through the expanded nodes
+        while (mcts->num_children[node] > 0 && !game_over) {
+            node = select_child(mcts, node, config->exploration);
+            mcts->path[depth++] = node;
+            game_over = play_node_move(mcts->game, mcts->move[node], &result);
+        }
+
+        // expansion: grow the tree at leaves that were already simulated once
+        if (!game_over && mcts->visits[node] > 0 && expand(mcts, node)) {
+            node = mcts->first_child[node];
+            mcts->path[depth++] = node;
+            game_over = play_node_move(mcts->game, mcts->move[node], &result);
+        }
+
+        // simulation: the random play is scored for the player to move, who is the opponent of the node's player
+        if (!game_over) {
+            result = -game_random_play_rng(mcts->game, mcts->move_buffer, &mcts->rng);
+        }
+
+        // backpropagation: the perspective switches with every level
+        for (int i = depth - 1; i >= 0; i--) {
+            mcts->visits[mcts->path[i]]++;
+            mcts->value_sum[mcts->path[i]] += result;
+            result = -result;
+        }
+
+        iterations++;
+    }
+
+    // the most visited move of the root is the most reliable one
+    uint32_t best_child = mcts->first_child[0];
+    for (uint32_t child = best_child; child < mcts->first_child[0] + mcts->num_children[0]; child++) {
+        if (mcts->visits[child] > mcts->visits[best_child]) {
+            best_child = child;
+        }
+    }
+
+    const uint8_t board_size = position->board->board_size;
+    MctsResult search_result;
+    search_result.x = mcts->move[best_child] % board_size;
+    search_result.y = mcts->move[best_child] / board_size;
+    search_result.visits = mcts->visits[best_child];
+    search_result.value = search_result.visits > 0 ? mcts->value_sum[best_child] / (float)search_result.visits : 0;
+    search_result.iterations = iterations;
+    search_result.num_nodes = mcts->num_nodes;
+
+    return search_result;
+}
+
+struct MctsWorker
+{
+    ParallelMcts* mcts; // search the worker belongs to
+    pthread_t thread;
+
+    // the current search, set before the threads start
+    const Game* position;
+    const MctsConfig* config;
+    _Atomic unsigned int* claimed_iterations; // iterations started by all the workers
+    double start_time;
+    unsigned int iterations; // iterations finished by this worker
+
+    // private scratch memory
+    Game* game;
+    uint8_t (*move_buffer)[2];
+    uint16_t* tile_buffer;
+    uint32_t* path;
+    Rng rng;
+};
+
+ParallelMcts* parallel_mcts_create(const uint8_t board_size, const uint32_t capacity, const unsigned int num_threads,
+                                   const uint64_t seed) {
+    if (capacity == 0 || num_threads == 0) {
+        throw_err("parallel_mcts_create", "Node capacity and number of threads cannot be 0.");
+    }
+
+    ParallelMcts* mcts = malloc(sizeof(ParallelMcts));
+    if (mcts == NULL) {
+        throw_err("parallel_mcts_create", "Couldn't allocate memory for a search.");
+        return NULL;
+    }
+
+    mcts->first_child = malloc(capacity * sizeof(*mcts->first_child));
+    mcts->num_children = malloc(capacity * sizeof(uint16_t));
+    mcts->move = malloc(capacity * sizeof(uint16_t));
+    mcts->visits = malloc(capacity * sizeof(*mcts->visits));
+    mcts->value_sum = malloc(capacity * sizeof(*mcts->value_sum));
+    atomic_init(&mcts->num_nodes, 0);
+    mcts->capacity = capacity;
+    mcts->board_size = board_size;
+    mcts->num_threads = num_threads;
+    mcts->workers = malloc(num_threads * sizeof(MctsWorker));
+
+    if (mcts->first_child == NULL || mcts->num_children == NULL || mcts->move == NULL || mcts->visits == NULL ||
+        mcts->value_sum == NULL || mcts->workers == NULL) {
+        throw_err("parallel_mcts_create", "Couldn't allocate memory for the search tree.");
+        return NULL;
+    }
+
+    const uint16_t num_tiles = board_size * board_size;
+    Rng rng;
+    rng_seed(&rng, seed);
+
+    for (unsigned int i = 0; i < num_threads; i++) {
+        MctsWorker* worker = &mcts->workers[i];
+        worker->mcts = mcts;
+        worker->game = game_create(board_size);
+        worker->move_buffer = malloc(num_tiles * sizeof(*worker->move_buffer));
+        worker->tile_buffer = malloc(num_tiles * sizeof(uint16_t));
+        worker->path = malloc((num_tiles + 1) * sizeof(uint32_t));
+        worker->rng = rng_split(&rng);
+
+        if (worker->move_buffer == NULL || worker->tile_buffer == NULL || worker->path == NULL) {
+            throw_err("parallel_mcts_create", "Couldn't allocate memory for the search threads.");
+            return NULL;
+        }
+    }
+
+    return mcts;
+}
+
+void parallel_mcts_free(ParallelMcts* mcts) {
+    if (mcts == NULL) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < mcts->num_threads; i++) {
+        game_free(mcts->workers[i].game);
+        free(mcts->workers[i].move_buffer);
+        free(mcts->workers[i].tile_buffer);
+        free(mcts->workers[i].path);
+    }
+
+    free(mcts->first_child);
+    free(mcts->num_children);
+    free(mcts->move);
+    free(mcts->visits);
+    free(mcts->value_sum);
+    free(mcts->workers);
+    free(mcts);
+}
+
+/**
+ * Reset a node of the shared tree. Only valid while no other thread can see the node.
+ * @param mcts Search the node belongs to.
+ * @param node Index of the node.
+ * @param move Tile index of the node's move.
+ */
+static void parallel_init_node(ParallelMcts* mcts, const uint32_t node, const uint16_t move) {
+    atomic_store_explicit(&mcts->first_child[node], 0, memory_order_relaxed);
+    atomic_store_explicit(&mcts->visits[node], 0, memory_order_relaxed);
+    atomic_store_explicit(&mcts->value_sum[node], 0, memory_order_relaxed);
+    mcts->num_children[node] = 0;
+    mcts->move[node] = move;
+}
+
+/**
+ * Count a running iteration as a visit that is lost for the node's player, until the real result comes back.
+ * @param mcts Search the node belongs to.
+ * @param node Index of the node.
+ */
+static void add_virtual_loss(ParallelMcts* mcts, const uint32_t node) {
+    atomic_fetch_add_explicit(&mcts->visits[node], 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&mcts->value_sum[node], 1, memory_order_relaxed);
+}
+
+/**
+ * Pick the child with the highest UCT score, the statistics include the virtual losses of running iterations.
+ * @param mcts Search the node belongs to.
+ * @param first Index of the node's first child.
+ * @param num_children Number of the node's children.
+ * @param parent_visits Visits of the node.
+ * @param exploration UCT exploration constant.
+ * @return Index of the selected child.
+ */
+static uint32_t parallel_select_child(ParallelMcts* mcts, const uint32_t first, const uint16_t num_children,
+                                      const uint32_t parent_visits, const float exploration) {
+    const float log_visits = logf((float)parent_visits);
+
+    uint32_t best_child = first;
+    float best_score = -INFINITY;
+
+    for (uint32_t child = first; child < first + num_children; child++) {
+        const uint32_t visits = atomic_load_explicit(&mcts->visits[child], memory_order_relaxed);
+
+        if (visits == 0) {
+            return child;
+        }
+
+        const int32_t value_sum = atomic_load_explicit(&mcts->value_sum[child], memory_order_relaxed);
+        const float score = (float)value_sum / (float)visits + exploration * sqrtf(log_visits / (float)visits);
+        if (score > best_score) {
+            best_score = score;
+            best_child = child;
+        }
+    }
+
+    return best_child;
+}
+
+/**
+ * Create the children of a node, unless another thread is already doing it. The children are reserved as one block
+ * by bumping the node count.
+ * @param worker Worker whose game is in the node's position.
+ * @param node Index of the node.
+ * @return Index of the first child, or 0 if the node wasn't expanded.
+ */
+static uint32_t parallel_expand(MctsWorker* worker, const uint32_t node) {
+    ParallelMcts* mcts = worker->mcts;
+
+    // claim the node, if it's already claimed it stays a leaf for this iteration
+    uint32_t expected = 0;
+    if (!atomic_compare_exchange_strong(&mcts->first_child[node], &expected, MCTS_EXPANDING)) {
+        return 0;
+    }
+
+    const uint16_t num_moves = board_get_legal_tiles(worker->tile_buffer, worker->game->board);
+
+    // reserve the block of children, when the pool is full the node stays claimed and is never expanded
+    uint32_t first = atomic_load_explicit(&mcts->num_nodes, memory_order_relaxed);
+    do {
+        if (num_moves == 0 || first + num_moves > mcts->capacity) {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak(&mcts->num_nodes, &first, first + num_moves));
+
+    for (uint16_t i = 0; i < num_moves; i++) {
+        parallel_init_node(mcts, first + i, worker->tile_buffer[i]);
+    }
+
+    // publish the children, the release store makes the initialized nodes visible together with the index
+    mcts->num_children[node] = num_moves;
+    atomic_store_explicit(&mcts->first_child[node], first, memory_order_release);
+
+    return first;
+}
+
+/**
+ * Thread entry point, run iterations on the shared tree until the budget runs out.
+ * @param argument Pointer to the MctsWorker.
+ * @return Always NULL.
+ */
+static void* parallel_mcts_worker_run(void* argument) {
+    MctsWorker* worker = argument;
+    ParallelMcts* mcts = worker->mcts;
+    const MctsConfig* config = worker->config;
+
+    worker->iterations = 0;
+
+    while (true) {
+        if (config->max_iterations > 0 &&
+            atomic_fetch_add_explicit(worker->claimed_iterations, 1, memory_order_relaxed) >= config->max_iterations) {
+            break;
+        }
+
+        if (config->max_seconds > 0 && seconds_now() - worker->start_time >= config->max_seconds) {
+            break;
+        }
+
+        game_copy_into(worker->game, worker->position);
+
+        uint32_t node = 0;
+        uint16_t depth = 0;
+        worker->path[depth++] = node;
+        add_virtual_loss(mcts, node);
+
+        float result = 0;
+        bool game_over = false;
+
+        // selection: descend through the published nodes
+        while (!game_over) {
+            const uint32_t first = atomic_load_explicit(&mcts->first_child[node], memory_order_acquire);
+            if (first == 0 || first == MCTS_EXPANDING) {
+                break;
+            }
+
+            const uint32_t parent_visits = atomic_load_explicit(&mcts->visits[node], memory_order_relaxed);
+            node = parallel_select_child(mcts, first, mcts->num_children[node], parent_visits, config->exploration);
+            worker->path[depth++] = node;
+            add_virtual_loss(mcts, node);
+            game_over = play_node_move(worker->game, mcts->move[node], &result);
+        }
+
+        // expansion: grow the tree at leaves that were visited before (this iteration's visit is already counted)
+        if (!game_over && atomic_load_explicit(&mcts->visits[node], memory_order_relaxed) > 1) {
+            const uint32_t first = parallel_expand(worker, node);
+
+            if (first != 0) {
+                node = first;
+                worker->path[depth++] = node;
+                add_virtual_loss(mcts, node);
+                game_over = play_node_move(worker->game, mcts->move[node], &result);
+            }
+        }
+
+        // simulation: the random play is scored for the player to move, who is the opponent of the node's player
+        if (!game_over) {
+            result = -game_random_play_rng(worker->game, worker->move_buffer, &worker->rng);
+        }
+
+        // backpropagation: replace the virtual losses with the real result, the visits were already counted
+        for (int i = depth - 1; i >= 0; i--) {
+            atomic_fetch_add_explicit(&mcts->value_sum[worker->path[i]], (int32_t)result + 1, memory_order_relaxed);
+            result = -result;
+        }
+
+        worker->iterations++;
+    }
+
+    return NULL;
+}
+
+MctsResult parallel_mcts_search(ParallelMcts* mcts, const Game* position, const MctsConfig* config) {
+    if (mcts == NULL || position == NULL || config == NULL) {
+        throw_err("parallel_mcts_search", "Search, position and config cannot be NULL.");
+    }
+
+    if (config->max_iterations == 0 && config->max_seconds <= 0) {
+        throw_err("parallel_mcts_search", "At least one of the budgets has to be set.");
+    }
+
+    if (position->board->board_size != mcts->board_size) {
+        throw_err("parallel_mcts_search", "Position size doesn't match the search.");
+    }
+
+    if (game_is_win_full(position) || game_is_tie(position)) {
+        throw_err("parallel_mcts_search", "Can't search a position where the game already ended.");
+    }
+
+    // start a new tree and expand the root before the threads start
+    atomic_store(&mcts->num_nodes, 1);
+    parallel_init_node(mcts, 0, 0);
+    game_copy_into(mcts->workers[0].game, position);
+    if (parallel_expand(&mcts->workers[0], 0) == 0) {
+        throw_err("parallel_mcts_search", "Node capacity is too small to expand the root.");
+    }
+
+    _Atomic unsigned int claimed_iterations = 0;
+    const double start_time = seconds_now();
+
+    for (unsigned int i = 0; i < mcts->num_threads; i++) {
+        mcts->workers[i].position = position;
+        mcts->workers[i].config = config;
+        mcts->workers[i].claimed_iterations = &claimed_iterations;
+        mcts->workers[i].start_time = start_time;
+    }
+
+    // the calling thread is the first worker
+    for (unsigned int i = 1; i < mcts->num_threads; i++) {
+        if (pthread_create(&mcts->workers[i].thread, NULL, parallel_mcts_worker_run, &mcts->workers[i]) != 0) {
+            throw_err("parallel_mcts_search", "Couldn't start a search thread.");
+        }
+    }
+    parallel_mcts_worker_run(&mcts->workers[0]);
+
+    unsigned int iterations = mcts->workers[0].iterations;
+    for (unsigned int i = 1; i < mcts->num_threads; i++) {
+        pthread_join(mcts->workers[i].thread, NULL);
+        iterations += mcts->workers[i].iterations;
+    }
+
+    // the most visited move of the root is the most reliable one
+    const uint32_t first = atomic_load(&mcts->first_child[0]);
+    uint32_t best_child = first;
+    for (uint32_t child = first; child < first + mcts->num_children[0]; child++) {
+        if (atomic_load(&mcts->visits[child]) > atomic_load(&mcts->visits[best_child])) {
+            best_child = child;
+        }
+    }
+
+    MctsResult search_result;
+    search_result.x = mcts->move[best_child] % mcts->board_size;
+    search_result.y = mcts->move[best_child] / mcts->board_size;
+    search_result.visits = atomic_load(&mcts->visits[best_child]);
+    search_result.value = search_result.visits > 0
+                              ? (float)atomic_load(&mcts->value_sum[best_child]) / (float)search_result.visits
+                              : 0;
+    search_result.iterations = iterations;
+    search_result.num_nodes = atomic_load(&mcts->num_nodes);
+
+    return search_result;
+}
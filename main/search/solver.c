@@ -0,0 +1,371 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "solver.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+// score of a win on the current move, every extra ply until the win costs one point
+#define SOLVER_WIN_SCORE 1000
+// scores above this (or below its negation) are proven wins (or losses)
+#define SOLVER_WIN_THRESHOLD (SOLVER_WIN_SCORE - SOLVER_MAX_DEPTH - 1)
+// larger than any score
+#define SOLVER_INFINITY (SOLVER_WIN_SCORE + 1)
+// depth of entries that are valid for a search of any depth
+#define SOLVER_EXACT_DEPTH UINT8_MAX
+// marks a missing move in the transposition table
+#define SOLVER_NO_MOVE UINT16_MAX
+// number of visited positions between two checks of the clock
+#define SOLVER_TIME_CHECK_INTERVAL 1024
+// base-2 logarithm of the number of entries of the table game_solve allocates (4 MiB)
+#define SOLVER_DEFAULT_TABLE_SIZE 18
+
+// state of one solve, shared by the whole recursion
+typedef struct
+{
+    Game* game;
+    TranspositionTable* table;
+    uint32_t* history; // history heuristic score of every tile, increased by moves that caused a cutoff
+    uint64_t nodes;
+    double deadline; // time to stop at, 0 for no limit
+    bool aborted; // the time ran out, the current iteration has to be thrown away
+    bool horizon_hit; // the current subtree was cut off by the depth limit somewhere
+    uint16_t root_move; // best move of the last search of the root
+} SolverState;
+
+TranspositionTable* transposition_table_create(const uint8_t log2_entries) {
+    if (log2_entries == 0 || log2_entries > 40) {
+        throw_err("transposition_table_create", "Table size 2^%d is out of range (1 to 40).", log2_entries);
+    }
+
+    TranspositionTable* table = malloc(sizeof(TranspositionTable));
+    if (table == NULL) {
+        throw_err("transposition_table_create", "Couldn't allocate memory for a transposition table.");
+        return NULL;
+    }
+
+    const size_t num_entries = (size_t)1 << log2_entries;
+    table->entries = malloc(num_entries * sizeof(TranspositionEntry));
+    if (table->entries == NULL) {
+        throw_err("transposition_table_create", "Couldn't allocate memory for %zu table entries.", num_entries);
+        return NULL;
+    }
+
+    table->mask = num_entries - 1;
+    transposition_table_clear(table);
+    return table;
+}
+
+void transposition_table_clear(TranspositionTable* table) {
+    memset(table->entries, 0, (table->mask + 1) * sizeof(TranspositionEntry));
+
+    // the generation of a cleared entry never matches, so the entries are treated as empty
+    for (uint64_t i = 0; i <= table->mask; i++) {
+        table->entries[i].best_move = SOLVER_NO_MOVE;
+    }
+    table->generation = 1;
+}
+
+void transposition_table_free(TranspositionTable* table) {
+    if (table == NULL) {
+        return;
+    }
+
+    free(table->entries);
+    free(table);
+}
+
+/**
+ * Convert a score relative to the root into a score relative to the position, so the entry is valid for any root.
+ * @param score Score from the search.
+ * @param ply Distance of the position from the root.
+ * @return Score to store.
+ */
+static inline int16_t score_to_table(const int score, const uint16_t ply) {
+    if (score > SOLVER_WIN_THRESHOLD) {
+        return (int16_t)(score + ply);
+    }
+    if (score < -SOLVER_WIN_THRESHOLD) {
+        return (int16_t)(score - ply);
+    }
+    return (int16_t)score;
+}
+
+/**
+ * Inverse of score_to_table.
+ * @param score Stored score.
+ * @param ply Distance of the position from the root.
+ * @return Score relative to the root.
+ */
+static inline int score_from_table(const int16_t score, const uint16_t ply) {
+    if (score > SOLVER_WIN_THRESHOLD) {
+        return score - ply;
+    }
+    if (score < -SOLVER_WIN_THRESHOLD) {
+        return score + ply;
+    }
+    return score;
+}
+
+/**
+ * Write a result into the table. An entry of another position is only replaced when it comes from an earlier solve or
+ * from a search that wasn't deeper.
+ */
+static void table_store(TranspositionTable* table, const uint64_t key, const int16_t score, const uint16_t best_move,
+                        const uint8_t depth, const BoundType bound) {
+    TranspositionEntry* entry = &table->entries[key & table->mask];
+
+    if (entry->key != key && entry->generation == table->generation && entry->depth > depth) {
+        return;
+    }
+
+    entry->key = key;
+    entry->score = score;
+    entry->best_move = best_move;
+    entry->depth = depth;
+    entry->bound = bound;
+    entry->generation = table->generation;
+}
+
+/**
+ * Find the entry of a position.
+ * @return Pointer to the entry, NULL if the position isn't in the table.
+ */
+static const TranspositionEntry* table_probe(const TranspositionTable* table, const uint64_t key) {
+    const TranspositionEntry* entry = &table->entries[key & table->mask];
+    return entry->key == key && entry->generation != 0 ? entry : NULL;
+}
+
+/**
+ * Search a position with negamax and alpha-beta pruning.
+ * @param state State of the solve, its game is in the position to search.
+ * @param depth Number of plies left to search (at least 1).
+ * @param alpha Lowest score the player to move can already force elsewhere.
+ * @param beta Highest score the opponent lets the player to move reach.
+ * @param ply Distance of the position from the root.
+ * @param moves Buffer for the legal moves of this position and all the positions below it.
+ * @return Score of the position from the perspective of the player to move (a bound if outside of alpha and beta).
+ */
+static int negamax(SolverState* state, const uint8_t depth, int alpha, const int beta, const uint16_t ply,
+                   uint16_t* moves) {
+    Game* game = state->game;
+    const uint8_t board_size = game->board->board_size;
+
+    state->nodes++;
+    if (state->deadline > 0 && state->nodes % SOLVER_TIME_CHECK_INTERVAL == 0 && seconds_now() >= state->deadline) {
+        state->aborted = true;
+    }
+    if (state->aborted) {
+        return 0;
+    }
+
+    const int original_alpha = alpha;
+    const uint64_t key = game->hash;
+    uint16_t table_move = SOLVER_NO_MOVE;
+
+    const TranspositionEntry* entry = table_probe(state->table, key);
+    if (entry != NULL) {
+        table_move = entry->best_move;
+
+        if (entry->depth >= depth && ply > 0) {
+            const int score = score_from_table(entry->score, ply);
+            if (entry->bound == BOUND_EXACT || (entry->bound == BOUND_LOWER && score >= beta) ||
+                (entry->bound == BOUND_UPPER && score <= alpha)) {
+                // a depth-limited score still depends on the horizon
+                state->horizon_hit |= entry->depth != SOLVER_EXACT_DEPTH;
+                return score;
+            }
+        }
+    }
+
+    const uint16_t num_moves = board_get_legal_tiles(moves, game->board);
+
+    // a move that wins right away can't be beaten, look for one before searching anything deeper
+    for (uint16_t i = 0; i < num_moves; i++) {
+        const uint8_t x = moves[i] % board_size;
+        const uint8_t y = moves[i] / board_size;
+
+        game_move_unchecked(game, x, y);
+        const bool is_win = game_is_win(game);
+        game_un_move_unchecked(game, x, y);
+
+        if (is_win) {
+            const int score = SOLVER_WIN_SCORE - (ply + 1);
+            table_store(state->table, key, score_to_table(score, ply), moves[i], SOLVER_EXACT_DEPTH, BOUND_EXACT);
+            if (ply == 0) {
+                state->root_move = moves[i];
+            }
+            return score;
+        }
+    }
+
+    // search the table move first
+    for (uint16_t i = 0; i < num_moves; i++) {
+        if (moves[i] == table_move) {
+            moves[i] = moves[0];
+            moves[0] = table_move;
+            break;
+        }
+    }
+
+    const bool outer_horizon_hit = state->horizon_hit;
+    state->horizon_hit = false;
+
+    int best_score = -SOLVER_INFINITY;
+    uint16_t best_move = moves[0];
+
+    for (uint16_t i = 0; i < num_moves; i++) {
+        // order the rest by the history heuristic, picking the best one lazily since a cutoff may come early
+        if (i > 0 || moves[0] != table_move) {
+            uint16_t best_index = i;
+            for (uint16_t j = i + 1; j < num_moves; j++) {
+                if (state->history[moves[j]] > state->history[moves[best_index]]) {
+                    best_index = j;
+                }
+            }
+            const uint16_t swap = moves[i];
+            moves[i] = moves[best_index];
+            moves[best_index] = swap;
+        }
+
+        const uint8_t x = moves[i] % board_size;
+        const uint8_t y = moves[i] / board_size;
+        int score;
+
+        // none of the moves wins, so a move either fills the board or leads to a position of the opponent
+        game_move_unchecked(game, x, y);
+        if (game_is_tie(game)) {
+            score = 0;
+        }
+        else if (depth == 1) {
+            score = 0;
+            state->horizon_hit = true;
+        }
+        else {
+            score = -negamax(state, depth - 1, -beta, -alpha, ply + 1, moves + num_moves);
+        }
+        game_un_move_unchecked(game, x, y);
+
+        if (state->aborted) {
+            return 0;
+        }
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = moves[i];
+        }
+        if (score > alpha) {
+            alpha = score;
+        }
+        if (alpha >= beta) {
+            state->history[moves[i]] += (uint32_t)depth * depth;
+            break;
+        }
+    }
+
+    const bool horizon_hit = state->horizon_hit;
+    state->horizon_hit = outer_horizon_hit || horizon_hit;
+
+    // proven wins and losses don't depend on the depth, neither does anything searched to the end of the game
+    const bool exact = !horizon_hit || best_score > SOLVER_WIN_THRESHOLD || best_score < -SOLVER_WIN_THRESHOLD;
+    const BoundType bound = best_score <= original_alpha ? BOUND_UPPER : best_score >= beta ? BOUND_LOWER : BOUND_EXACT;
+    table_store(state->table, key, score_to_table(best_score, ply), best_move, exact ? SOLVER_EXACT_DEPTH : depth,
+                bound);
+
+    if (ply == 0) {
+        state->root_move = best_move;
+    }
+
+    return best_score;
+}
+
+SolveResult game_solve(Game* game, const uint8_t max_depth, const double time_budget) {
+    TranspositionTable* table = transposition_table_create(SOLVER_DEFAULT_TABLE_SIZE);
+    const SolveResult result = game_solve_with_table(game, max_depth, time_budget, table);
+    transposition_table_free(table);
+    return result;
+}
+
+SolveResult game_solve_with_table(Game* game, const uint8_t max_depth, const double time_budget,
+                                  TranspositionTable* table) {
+    if (game == NULL || table == NULL) {
+        throw_err("game_solve", "Game and transposition table cannot be NULL.");
+    }
+
+    if (game_is_win_full(game) || game_is_tie(game)) {
+        throw_err("game_solve", "Can't solve a position where the game already ended.");
+    }
+
+    const uint8_t board_size = game->board->board_size;
+    const uint16_t num_tiles = board_size * board_size;
+    const uint16_t num_empty = num_tiles - game->turns_taken;
+
+    uint8_t depth_limit = max_depth == 0 || max_depth > SOLVER_MAX_DEPTH ? SOLVER_MAX_DEPTH : max_depth;
+    if (depth_limit > num_empty) {
+        depth_limit = num_empty;
+    }
+
+    // every ply needs room for the legal moves of its position, and there's one legal move less each ply
+    size_t stack_size = 0;
+    for (uint16_t ply = 0; ply < depth_limit; ply++) {
+        stack_size += num_empty - ply;
+    }
+
+    uint16_t* moves = malloc(stack_size * sizeof(uint16_t));
+    uint32_t* history = calloc(num_tiles, sizeof(uint32_t));
+    if (moves == NULL || history == NULL) {
+        throw_err("game_solve", "Couldn't allocate memory for the search.");
+    }
+
+    // the hash is the table key, make sure it isn't stale after direct board edits
+    game->hash = game_compute_hash(game);
+    const uint8_t last_x = game->last_x;
+    const uint8_t last_y = game->last_y;
+
+    // generation 0 marks empty entries
+    table->generation = table->generation == UINT8_MAX ? 1 : table->generation + 1;
+
+    SolverState state = {0};
+    state.game = game;
+    state.table = table;
+    state.history = history;
+    state.root_move = SOLVER_NO_MOVE;
+
+    SolveResult result = {0};
+    const double deadline = time_budget > 0 ? seconds_now() + time_budget : 0;
+
+    for (uint8_t depth = 1; depth <= depth_limit; depth++) {
+        // the first iteration always completes, so there's always a move to return
+        state.deadline = depth > 1 ? deadline : 0;
+        state.horizon_hit = false;
+
+        const int score = negamax(&state, depth, -SOLVER_INFINITY, SOLVER_INFINITY, 0, moves);
+        if (state.aborted) {
+            break;
+        }
+
+        result.x = state.root_move % board_size;
+        result.y = state.root_move / board_size;
+        result.depth = depth;
+        result.value = score > SOLVER_WIN_THRESHOLD ? 1 : score < -SOLVER_WIN_THRESHOLD ? -1 : 0;
+        result.plies_to_end = result.value == 0 ? 0 : SOLVER_WIN_SCORE - abs(score);
+        result.solved = result.value != 0 || !state.horizon_hit;
+
+        if (result.solved) {
+            break;
+        }
+    }
+
+    result.nodes = state.nodes;
+    game->last_x = last_x;
+    game->last_y = last_y;
+
+    free(moves);
+    free(history);
+    return result;
+}
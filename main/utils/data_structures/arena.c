@@ -0,0 +1,100 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <stdalign.h>
+#include <stdlib.h>
+#include "utils/functions/std_utils.h"
+#include "arena.h"
+
+struct ArenaChunk
+{
+    ArenaChunk* next; // next chunk in the list
+    size_t capacity; // number of bytes in the data array
+    size_t used; // number of bytes already handed out
+    alignas(max_align_t) unsigned char data[];
+};
+
+/**
+ * Allocate a chunk with a given capacity.
+ * @param capacity Number of bytes in the chunk.
+ * @return Pointer to the chunk.
+ */
+static ArenaChunk* arena_chunk_create(const size_t capacity) {
+    ArenaChunk* chunk = malloc(sizeof(ArenaChunk) + capacity);
+
+    if (chunk == NULL) {
+        throw_err("arena_chunk_create", "Failed to allocate memory for an arena chunk.");
+        return NULL;
+    }
+
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+
+    return chunk;
+}
+
+OxoxArena* oxox_arena_create(const size_t chunk_capacity) {
+    if (chunk_capacity == 0) {
+        throw_err("oxox_arena_create", "Chunk capacity cannot be 0.");
+    }
+
+    OxoxArena* arena = malloc(sizeof(OxoxArena));
+
+    if (arena == NULL) {
+        throw_err("oxox_arena_create", "Failed to allocate memory for an arena.");
+        return NULL;
+    }
+
+    arena->chunk_capacity = chunk_capacity;
+    arena->first = arena_chunk_create(chunk_capacity);
+    arena->current = arena->first;
+
+    return arena;
+}
+
+void* oxox_arena_alloc(OxoxArena* arena, const size_t size) {
+    // keep every allocation aligned for any type
+    const size_t aligned_size = (size + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+    // skip the chunks that are too full (after a reset, the following chunks are empty and get reused)
+    while (arena->current->used + aligned_size > arena->current->capacity) {
+        if (arena->current->next == NULL) {
+            const size_t capacity = aligned_size > arena->chunk_capacity ? aligned_size : arena->chunk_capacity;
+            arena->current->next = arena_chunk_create(capacity);
+        }
+
+        arena->current = arena->current->next;
+    }
+
+    void* memory = arena->current->data + arena->current->used;
+    arena->current->used += aligned_size;
+
+    return memory;
+}
+
+void oxox_arena_reset(OxoxArena* arena) {
+    for (ArenaChunk* chunk = arena->first; chunk != NULL; chunk = chunk->next) {
+        chunk->used = 0;
+    }
+
+    arena->current = arena->first;
+}
+
+void oxox_arena_free(OxoxArena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    ArenaChunk* chunk = arena->first;
+    while (chunk != NULL) {
+        ArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    arena->first = NULL;
+    arena->current = NULL;
+    free(arena);
+}
@@ -4,8 +4,150 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include "utils/functions/stat_counters.h"
 #include "utils/functions/std_utils.h"
 #include "bitset.h"
+#include "unchecked.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BITSET_X86
+#endif
+
+// bitsets with at least this many words use the combine kernel, smaller ones are handled inline
+#define BITSET_KERNEL_MIN_WORDS 4
+
+// element-wise operations of the bulk functions
+typedef enum
+{
+    COMBINE_AND,
+    COMBINE_OR,
+    COMBINE_XOR,
+    COMBINE_ANDNOT,
+    COMBINE_NOT, // only uses the left operand (the right one must still be readable)
+} CombineOperation;
+
+// combines the words of two operands into the target, the target may be one of the operands
+typedef void (*CombineKernel)(uint64_t* target, const uint64_t* left, const uint64_t* right, size_t num_words,
+                              CombineOperation operation);
+
+// counts the set bits of the words
+typedef size_t (*PopcountKernel)(const uint64_t* words, size_t num_words);
+
+/**
+ * Portable kernel, one word at a time.
+ */
+static void combine_words_scalar(uint64_t* target, const uint64_t* left, const uint64_t* right, const size_t num_words,
+                                 const CombineOperation operation) {
+    switch (operation) {
+        case COMBINE_AND:
+            for (size_t i = 0; i < num_words; i++) {
+                target[i] = left[i] & right[i];
+            }
+            break;
+        case COMBINE_OR:
+            for (size_t i = 0; i < num_words; i++) {
+                target[i] = left[i] | right[i];
+            }
+            break;
+        case COMBINE_XOR:
+            for (size_t i = 0; i < num_words; i++) {
+                target[i] = left[i] ^ right[i];
+            }
+            break;
+        case COMBINE_ANDNOT:
+            for (size_t i = 0; i < num_words; i++) {
+                target[i] = left[i] & ~right[i];
+            }
+            break;
+        case COMBINE_NOT:
+            for (size_t i = 0; i < num_words; i++) {
+                target[i] = ~left[i];
+            }
+            break;
+    }
+}
+
+/**
+ * Portable kernel, counts the bits with the compiler's builtin (a library call unless the build enables POPCNT).
+ */
+static size_t popcount_words_scalar(const uint64_t* words, const size_t num_words) {
+    size_t count = 0;
+    for (size_t i = 0; i < num_words; i++) {
+        count += __builtin_popcountll(words[i]);
+    }
+    return count;
+}
+
+#ifdef BITSET_X86
+/**
+ * AVX2 kernel, 4 words per instruction. Compiled for AVX2 regardless of the build flags and only called when the CPU
+ * supports it. The loads are unaligned, so bitsets that don't come from bitset_create work as well.
+ */
+__attribute__((target("avx2"))) static void combine_words_avx2(uint64_t* target, const uint64_t* left,
+                                                               const uint64_t* right, const size_t num_words,
+                                                               const CombineOperation operation) {
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    size_t i = 0;
+
+    for (; i + 4 <= num_words; i += 4) {
+        const __m256i l = _mm256_loadu_si256((const __m256i*)&left[i]);
+        const __m256i r = _mm256_loadu_si256((const __m256i*)&right[i]);
+        __m256i result;
+
+        switch (operation) {
+            case COMBINE_AND:
+                result = _mm256_and_si256(l, r);
+                break;
+            case COMBINE_OR:
+                result = _mm256_or_si256(l, r);
+                break;
+            case COMBINE_XOR:
+                result = _mm256_xor_si256(l, r);
+                break;
+            case COMBINE_ANDNOT:
+                result = _mm256_andnot_si256(r, l);
+                break;
+            default: // COMBINE_NOT
+                result = _mm256_xor_si256(l, ones);
+                break;
+        }
+
+        _mm256_storeu_si256((__m256i*)&target[i], result);
+    }
+
+    // the remaining words (less than 4)
+    combine_words_scalar(target + i, left + i, right + i, num_words - i, operation);
+}
+
+/**
+ * POPCNT kernel, one instruction per word.
+ */
+__attribute__((target("popcnt"))) static size_t popcount_words_popcnt(const uint64_t* words, const size_t num_words) {
+    size_t count = 0;
+    for (size_t i = 0; i < num_words; i++) {
+        count += __builtin_popcountll(words[i]);
+    }
+    return count;
+}
+#endif
+
+static CombineKernel combine_kernel = combine_words_scalar;
+static PopcountKernel popcount_kernel = popcount_words_scalar;
+
+// runs once when the library is loaded, picks the widest kernels the CPU supports
+__attribute__((constructor)) static void bitset_select_kernels(void) {
+#ifdef BITSET_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        combine_kernel = combine_words_avx2;
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        popcount_kernel = popcount_words_popcnt;
+    }
+#endif
+}
 
 BitSet* bitset_create(const size_t size) {
     if (size == 0) {
@@ -20,18 +162,21 @@ BitSet* bitset_create(const size_t size) {
         return NULL;
     }
 
+    STAT_INC(STAT_BITSET_ALLOCATIONS);
+
     bitset->size = size;
 
-    // allocate memory for the byte array
-    const size_t byte_count = (size + 7) / 8; // number of bytes needed
-    bitset->bits = (uint8_t*)calloc(byte_count, sizeof(uint8_t));
+    // allocate memory for the words, aligned_alloc needs the size to be a multiple of the alignment
+    const size_t byte_count = bitset_reserved_words(size) * sizeof(uint64_t);
+    bitset->bits = aligned_alloc(BITSET_ALIGNMENT, byte_count);
 
     if (bitset->bits == NULL) {
         throw_err("bitset_create", "Failed to allocate memory for BitSet data.");
         free(bitset);
-        bitset = NULL;
+        return NULL;
     }
 
+    memset(bitset->bits, 0, byte_count);
     return bitset;
 }
 
@@ -42,13 +187,17 @@ BitSet* bitset_clone(const BitSet* original) {
     }
 
     BitSet* bitset = bitset_create(original->size);
-    const size_t byte_count = (bitset->size + 7) / 8;
+    memcpy(bitset->bits, original->bits, bitset_num_words(original->size) * sizeof(uint64_t));
+
+    return bitset;
+}
 
-    for (size_t i = 0; i < byte_count; i++) {
-        bitset->bits[i] = original->bits[i];
+void bitset_copy_into(const BitSet* target, const BitSet* source) {
+    if (target->size != source->size) {
+        throw_err("bitset_copy_into", "Bitset sizes don't match.");
     }
 
-    return bitset;
+    memcpy(target->bits, source->bits, bitset_num_words(source->size) * sizeof(uint64_t));
 }
 
 void bitset_free(BitSet* bitset) {
@@ -66,7 +215,7 @@ void bitset_set(const BitSet* bitset, const size_t index) {
         throw_err("bitset_set", "Index out of bounds.");
     }
 
-    bitset->bits[index / 8] |= (1 << (index % 8));
+    bitset_set_unchecked(bitset, index);
 }
 
 void bitset_clear(const BitSet* bitset, const size_t index) {
@@ -74,7 +223,7 @@ void bitset_clear(const BitSet* bitset, const size_t index) {
         throw_err("bitset_clear", "Index out of bounds.");
     }
 
-    bitset->bits[index / 8] &= ~(1 << (index % 8));
+    bitset_clear_unchecked(bitset, index);
 }
 
 void bitset_flip(const BitSet* bitset, const size_t index) {
@@ -82,7 +231,7 @@ void bitset_flip(const BitSet* bitset, const size_t index) {
         throw_err("bitset_flip", "Index out of bounds.");
     }
 
-    bitset->bits[index / 8] ^= (1 << (index % 8));
+    bitset->bits[index / 64] ^= (uint64_t)1 << (index % 64);
 }
 
 bool bitset_get(const BitSet* bitset, const size_t index) {
@@ -90,14 +239,121 @@ bool bitset_get(const BitSet* bitset, const size_t index) {
         throw_err("bitset_get", "Index out of bounds.");
     }
 
-    return (bitset->bits[index / 8] & (1 << (index % 8))) != 0;
+    return bitset_get_unchecked(bitset, index);
+}
+
+/**
+ * Apply an element-wise operation to whole bitsets.
+ * @param name Name of the public function, for the error message.
+ * @param target Bitset to overwrite.
+ * @param left First operand.
+ * @param right Second operand (the same as the first one for NOT).
+ * @param operation Operation to apply.
+ */
+static void bitset_combine(const char* name, const BitSet* target, const BitSet* left, const BitSet* right,
+                           const CombineOperation operation) {
+    if (target->size != left->size || target->size != right->size) {
+        throw_err(name, "Bitset sizes don't match.");
+    }
+
+    const size_t num_words = bitset_num_words(target->size);
+    if (num_words >= BITSET_KERNEL_MIN_WORDS) {
+        combine_kernel(target->bits, left->bits, right->bits, num_words, operation);
+    }
+    else {
+        combine_words_scalar(target->bits, left->bits, right->bits, num_words, operation);
+    }
+
+    // NOT sets the bits past the size, they have to stay 0
+    if (operation == COMBINE_NOT && target->size % 64 != 0) {
+        target->bits[num_words - 1] &= ((uint64_t)1 << target->size % 64) - 1;
+    }
+}
+
+void bitset_and(const BitSet* target, const BitSet* left, const BitSet* right) {
+    bitset_combine("bitset_and", target, left, right, COMBINE_AND);
+}
+
+void bitset_or(const BitSet* target, const BitSet* left, const BitSet* right) {
+    bitset_combine("bitset_or", target, left, right, COMBINE_OR);
+}
+
+void bitset_xor(const BitSet* target, const BitSet* left, const BitSet* right) {
+    bitset_combine("bitset_xor", target, left, right, COMBINE_XOR);
+}
+
+void bitset_andnot(const BitSet* target, const BitSet* left, const BitSet* right) {
+    bitset_combine("bitset_andnot", target, left, right, COMBINE_ANDNOT);
+}
+
+void bitset_not(const BitSet* target, const BitSet* source) {
+    bitset_combine("bitset_not", target, source, source, COMBINE_NOT);
+}
+
+size_t bitset_popcount(const BitSet* bitset) {
+    return popcount_kernel(bitset->bits, bitset_num_words(bitset->size));
+}
+
+/**
+ * Find the lowest set bit, starting with a masked word.
+ * @param bitset Bitset to search.
+ * @param word_index Index of the first word to search.
+ * @param word The first word, with the bits that shouldn't be found cleared.
+ * @return Index of the bit, or BITSET_NOT_FOUND.
+ */
+static size_t find_set_from(const BitSet* bitset, size_t word_index, uint64_t word) {
+    const size_t num_words = bitset_num_words(bitset->size);
+
+    while (word == 0) {
+        if (++word_index >= num_words) {
+            return BITSET_NOT_FOUND;
+        }
+        word = bitset->bits[word_index];
+    }
+
+    return word_index * 64 + __builtin_ctzll(word);
+}
+
+size_t bitset_find_first_set(const BitSet* bitset) {
+    return find_set_from(bitset, 0, bitset->bits[0]);
+}
+
+size_t bitset_find_next_set(const BitSet* bitset, const size_t index) {
+    if (index >= bitset->size - 1) {
+        return BITSET_NOT_FOUND;
+    }
+
+    // clear the bits up to the index (including it) in its word
+    const size_t word_index = index / 64;
+    const uint64_t mask = index % 64 == 63 ? 0 : UINT64_MAX << (index % 64 + 1);
+    return find_set_from(bitset, word_index, bitset->bits[word_index] & mask);
+}
+
+bool bitset_equals(const BitSet* left, const BitSet* right) {
+    return left->size == right->size &&
+           memcmp(left->bits, right->bits, bitset_num_words(left->size) * sizeof(uint64_t)) == 0;
+}
+
+uint64_t bitset_hash(const BitSet* bitset) {
+    const size_t num_words = bitset_num_words(bitset->size);
+    uint64_t hash = bitset->size * 0x9E3779B97F4A7C15;
+
+    for (size_t i = 0; i < num_words; i++) {
+        hash = (hash ^ bitset->bits[i]) * 0xBF58476D1CE4E5B9;
+        hash ^= hash >> 31;
+    }
+
+    // splitmix64 finalizer, so every input bit affects every output bit
+    hash = (hash ^ hash >> 30) * 0xBF58476D1CE4E5B9;
+    hash = (hash ^ hash >> 27) * 0x94D049BB133111EB;
+    return hash ^ hash >> 31;
 }
 
 void bitset_to_string(const BitSet* bitset, char* buffer) {
     size_t buffer_index = 0;
 
     for (size_t i = 0; i < bitset->size; i++) {
-        buffer[buffer_index++] = bitset_get(bitset, i) ? '1' : '0';
+        buffer[buffer_index++] = bitset_get_unchecked(bitset, i) ? '1' : '0';
     }
 
     buffer[buffer_index] = '\0'; // null-terminate the string
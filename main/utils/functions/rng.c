@@ -0,0 +1,95 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "rng.h"
+
+#include "utils/functions/std_utils.h"
+
+/**
+ * Advance a splitmix64 state and return the next output (used to expand a seed into the generator state).
+ * @param state State to advance.
+ * @return Next pseudo-random number.
+ */
+static uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t rotate_left(const uint64_t x, const int k) {
+    return x << k | x >> (64 - k);
+}
+
+void rng_seed(Rng* rng, const uint64_t seed) {
+    uint64_t seed_state = seed;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        rng->state[i] = splitmix64(&seed_state);
+    }
+}
+
+uint64_t rng_next(Rng* rng) {
+    uint64_t* s = rng->state;
+    const uint64_t result = rotate_left(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotate_left(s[3], 45);
+
+    return result;
+}
+
+uint32_t rng_below(Rng* rng, const uint32_t bound) {
+    if (bound == 0) {
+        throw_err("rng_below", "Bound cannot be 0.");
+    }
+
+    // the high 32 bits of a 32x32-bit product are in [0, bound), the low bits decide if the sample is biased
+    uint64_t product = (rng_next(rng) >> 32) * bound;
+    uint32_t low = (uint32_t)product;
+
+    if (low < bound) {
+        // only now the division is needed, to find the threshold of the biased samples
+        const uint32_t threshold = -bound % bound;
+
+        while (low < threshold) {
+            product = (rng_next(rng) >> 32) * bound;
+            low = (uint32_t)product;
+        }
+    }
+
+    return (uint32_t)(product >> 32);
+}
+
+void rng_jump(Rng* rng) {
+    static const uint64_t JUMP[4] = {0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+    uint64_t jumped[4] = {0, 0, 0, 0};
+
+    for (uint8_t i = 0; i < 4; i++) {
+        for (uint8_t b = 0; b < 64; b++) {
+            if (JUMP[i] & (uint64_t)1 << b) {
+                for (uint8_t j = 0; j < 4; j++) {
+                    jumped[j] ^= rng->state[j];
+                }
+            }
+
+            rng_next(rng);
+        }
+    }
+
+    for (uint8_t i = 0; i < 4; i++) {
+        rng->state[i] = jumped[i];
+    }
+}
+
+Rng rng_split(Rng* rng) {
+    const Rng split = *rng;
+    rng_jump(rng);
+    return split;
+}
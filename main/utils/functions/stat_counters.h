@@ -0,0 +1,64 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef STAT_COUNTERS_H
+#define STAT_COUNTERS_H
+
+#include "stats.h"
+
+// index of every counter in the per-thread block, in the same order as the fields of OxoxStats
+typedef enum
+{
+    STAT_BITSET_ALLOCATIONS,
+    STAT_BOARD_ALLOCATIONS,
+    STAT_GAME_ALLOCATIONS,
+    STAT_WIN_CHECKS,
+    STAT_BOARD_GETS,
+    STAT_MOVES,
+    STAT_PLAYOUTS,
+    STAT_PLAYOUT_MOVES,
+    STAT_PLAYOUT_WINS,
+    STAT_PLAYOUT_DRAWS,
+    STAT_PLAYOUT_LOSSES,
+    NUM_STAT_COUNTERS,
+} StatCounter;
+
+#ifdef OXOX_STATS
+#include <stdatomic.h>
+
+/**
+ * Return the counters of the calling thread, they're registered on the first call.
+ * @return Array of NUM_STAT_COUNTERS counters.
+ */
+_Atomic uint64_t* stats_thread_counters(void);
+
+/**
+ * Add to a counter of the calling thread. Only the owning thread writes to its counters, so a relaxed load and store
+ * is enough (a plain add, no locked instruction), the atomics only make the reads of oxox_stats_snapshot well-defined.
+ */
+static inline void stats_add(const StatCounter counter, const uint64_t amount) {
+    _Atomic uint64_t* value = &stats_thread_counters()[counter];
+    atomic_store_explicit(value, atomic_load_explicit(value, memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+#define STAT_ADD(counter, amount) stats_add(counter, amount)
+#else
+// the arguments are still used, so the variables that only feed the counters don't trigger warnings
+#define STAT_ADD(counter, amount) ((void)(counter), (void)(amount))
+#endif
+
+#define STAT_INC(counter) STAT_ADD(counter, 1)
+
+/**
+ * Count a finished random play.
+ * @param length Number of moves the play made.
+ * @param result Result from the perspective of the starting player (1, 0 or -1).
+ */
+static inline void stats_record_playout(const uint64_t length, const int result) {
+    STAT_INC(STAT_PLAYOUTS);
+    STAT_ADD(STAT_PLAYOUT_MOVES, length);
+    STAT_INC(result > 0 ? STAT_PLAYOUT_WINS : result < 0 ? STAT_PLAYOUT_LOSSES : STAT_PLAYOUT_DRAWS);
+}
+
+#endif //STAT_COUNTERS_H
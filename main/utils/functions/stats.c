@@ -0,0 +1,142 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "stats.h"
+
+#include "stat_counters.h"
+
+#ifdef OXOX_STATS
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "std_utils.h"
+
+// counters of one thread, linked into the list of live threads
+typedef struct StatsBlock
+{
+    _Atomic uint64_t counters[NUM_STAT_COUNTERS];
+    struct StatsBlock* previous;
+    struct StatsBlock* next;
+} StatsBlock;
+
+// guards the list and the retired counters, it's only taken when a thread starts or exits and by the snapshots
+static pthread_mutex_t STATS_LOCK = PTHREAD_MUTEX_INITIALIZER;
+static StatsBlock* LIVE_BLOCKS = NULL;
+// counters of the threads that already exited
+static uint64_t RETIRED_COUNTERS[NUM_STAT_COUNTERS];
+
+static pthread_key_t STATS_KEY;
+static pthread_once_t STATS_KEY_ONCE = PTHREAD_ONCE_INIT;
+static _Thread_local StatsBlock* THREAD_BLOCK = NULL;
+
+/**
+ * Thread exit destructor, move the counters of the thread into the retired ones and free its block.
+ * @param argument Pointer to the thread's StatsBlock.
+ */
+static void stats_block_retire(void* argument) {
+    StatsBlock* block = argument;
+
+    pthread_mutex_lock(&STATS_LOCK);
+    for (int i = 0; i < NUM_STAT_COUNTERS; i++) {
+        RETIRED_COUNTERS[i] += atomic_load_explicit(&block->counters[i], memory_order_relaxed);
+    }
+    if (block->previous != NULL) {
+        block->previous->next = block->next;
+    }
+    else {
+        LIVE_BLOCKS = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->previous = block->previous;
+    }
+    pthread_mutex_unlock(&STATS_LOCK);
+
+    free(block);
+}
+
+static void stats_create_key(void) {
+    pthread_key_create(&STATS_KEY, stats_block_retire);
+}
+
+_Atomic uint64_t* stats_thread_counters(void) {
+    if (THREAD_BLOCK != NULL) {
+        return THREAD_BLOCK->counters;
+    }
+
+    StatsBlock* block = calloc(1, sizeof(StatsBlock));
+    if (block == NULL) {
+        throw_err("stats_thread_counters", "Couldn't allocate memory for the thread's counters.");
+        return NULL;
+    }
+
+    // the key's destructor runs when the thread exits
+    pthread_once(&STATS_KEY_ONCE, stats_create_key);
+    pthread_setspecific(STATS_KEY, block);
+
+    pthread_mutex_lock(&STATS_LOCK);
+    block->next = LIVE_BLOCKS;
+    if (LIVE_BLOCKS != NULL) {
+        LIVE_BLOCKS->previous = block;
+    }
+    LIVE_BLOCKS = block;
+    pthread_mutex_unlock(&STATS_LOCK);
+
+    THREAD_BLOCK = block;
+    return block->counters;
+}
+
+OxoxStats oxox_stats_snapshot(void) {
+    uint64_t totals[NUM_STAT_COUNTERS];
+
+    pthread_mutex_lock(&STATS_LOCK);
+    for (int i = 0; i < NUM_STAT_COUNTERS; i++) {
+        totals[i] = RETIRED_COUNTERS[i];
+    }
+    for (const StatsBlock* block = LIVE_BLOCKS; block != NULL; block = block->next) {
+        for (int i = 0; i < NUM_STAT_COUNTERS; i++) {
+            totals[i] += atomic_load_explicit(&block->counters[i], memory_order_relaxed);
+        }
+    }
+    pthread_mutex_unlock(&STATS_LOCK);
+
+    OxoxStats stats;
+    stats.bitset_allocations = totals[STAT_BITSET_ALLOCATIONS];
+    stats.board_allocations = totals[STAT_BOARD_ALLOCATIONS];
+    stats.game_allocations = totals[STAT_GAME_ALLOCATIONS];
+    stats.win_checks = totals[STAT_WIN_CHECKS];
+    stats.board_gets = totals[STAT_BOARD_GETS];
+    stats.moves = totals[STAT_MOVES];
+    stats.playouts = totals[STAT_PLAYOUTS];
+    stats.playout_moves = totals[STAT_PLAYOUT_MOVES];
+    stats.playout_wins = totals[STAT_PLAYOUT_WINS];
+    stats.playout_draws = totals[STAT_PLAYOUT_DRAWS];
+    stats.playout_losses = totals[STAT_PLAYOUT_LOSSES];
+    return stats;
+}
+
+void oxox_stats_reset(void) {
+    pthread_mutex_lock(&STATS_LOCK);
+    for (int i = 0; i < NUM_STAT_COUNTERS; i++) {
+        RETIRED_COUNTERS[i] = 0;
+    }
+
+    // a thread that is counting at the same time can write its old value back, reset while the threads are idle
+    for (StatsBlock* block = LIVE_BLOCKS; block != NULL; block = block->next) {
+        for (int i = 0; i < NUM_STAT_COUNTERS; i++) {
+            atomic_store_explicit(&block->counters[i], 0, memory_order_relaxed);
+        }
+    }
+    pthread_mutex_unlock(&STATS_LOCK);
+}
+
+#else
+
+OxoxStats oxox_stats_snapshot(void) {
+    return (OxoxStats){0};
+}
+
+void oxox_stats_reset(void) {
+}
+
+#endif
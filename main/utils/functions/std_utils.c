@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <time.h>
 #include "std_utils.h"
 
 void println(const char *message, ...) {
@@ -37,3 +38,9 @@ void assert(const bool expression, const char *fail_message, ...) {
     va_end(args);
     putchar('\n');
 }
+
+double seconds_now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
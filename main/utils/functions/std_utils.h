@@ -29,4 +29,10 @@ void throw_err(const char* functionName, const char* message, ...);
  */
 void assert(bool expression, const char* fail_message, ...);
 
+/**
+ * Return the current value of a monotonic clock, for measuring time budgets.
+ * @return Time in seconds (from an arbitrary starting point).
+ */
+double seconds_now(void);
+
 #endif //STD_UTILS_H
@@ -0,0 +1,19 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <cstdio>
+
+#include "game/test_oxox.h"
+
+int main() {
+    // test the C++ API
+    test_oxox_move();
+    test_oxox_is_win();
+    test_oxox_conversion();
+    test_oxox_random_play();
+
+    printf("All C++ tests passed.\n");
+
+    return 0;
+}
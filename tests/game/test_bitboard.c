@@ -0,0 +1,154 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_bitboard.h"
+
+#include <string.h>
+
+#include "bitboard.h"
+#include "utils/functions/std_utils.h"
+
+void test_bitboard_init(void) {
+    const BitBoard bitboard3 = bitboard_create(3);
+    assert(bitboard3.board_size == 3, "3x3 bitboard has incorrect size.");
+    assert(bitboard3.num_words == 1, "3x3 bitboard should use a single 64-bit word.");
+    assert(bitboard3.player_one_board[0] == 0 && bitboard3.player_two_board[0] == 0,
+           "3x3 bitboard wasn't initialized empty.");
+
+    assert(bitboard_create(8).num_words == 1, "8x8 bitboard should use a single 64-bit word.");
+    assert(bitboard_create(9).num_words == 2, "9x9 bitboard should use 128 bits.");
+    assert(bitboard_create(11).num_words == 2, "11x11 bitboard should use 128 bits.");
+    assert(bitboard_create(12).num_words == 4, "12x12 bitboard should use 256 bits.");
+    assert(bitboard_create(16).num_words == 4, "16x16 bitboard should use 256 bits.");
+}
+
+void test_bitboard_from_board(void) {
+    Board* board9 = board_create(9);
+    board_set(board9, 0, 0, X);
+    board_set(board9, 7, 7, O);
+    board_set(board9, 8, 8, X);
+
+    const BitBoard bitboard9 = bitboard_from_board(board9);
+    assert(bitboard9.player_one_board[0] == 1, "X at 0,0 converted incorrectly to a 9x9 bitboard.");
+    assert(bitboard9.player_two_board[1] == (uint64_t)1 << (70 - 64),
+           "O at 7,7 converted incorrectly to a 9x9 bitboard.");
+    assert(bitboard9.player_one_board[1] == (uint64_t)1 << (80 - 64),
+           "X at 8,8 converted incorrectly to a 9x9 bitboard.");
+
+    board_free(board9);
+    board9 = NULL;
+}
+
+void test_bitboard_to_board(void) {
+    const char* repr = "X__O_OX____X____";
+
+    Board* board4 = board_create(4);
+    board_from_string(board4, repr);
+    const BitBoard bitboard4 = bitboard_from_board(board4);
+
+    // a plain struct copy is a full clone
+    BitBoard clone = bitboard4;
+    bitboard_set(&clone, 1, 0, O);
+    assert(bitboard_get(&bitboard4, 1, 0) == EMPTY, "Modifying a copied bitboard changed the original.");
+
+    Board* converted = board_create(4);
+    board_from_string(converted, "OOOOOOOOOOOOOOOO");
+    bitboard_to_board(&bitboard4, converted);
+
+    char buffer[17];
+    board_to_string(converted, buffer);
+    assert(strcmp(buffer, repr) == 0, "Bitboard wasn't converted back to a board correctly.");
+
+    board_free(board4);
+    board_free(converted);
+    board4 = NULL;
+    converted = NULL;
+}
+
+void test_bitboard_get(void) {
+    BitBoard bitboard16 = bitboard_create(16);
+    bitboard16.player_one_board[3] = (uint64_t)1 << 63;
+    bitboard16.player_two_board[1] = 1;
+
+    assert(bitboard_get(&bitboard16, 15, 15) == X, "Incorrect player returned on tile 15,15 in a 16x16 bitboard.");
+    assert(bitboard_get(&bitboard16, 0, 4) == O, "Incorrect player returned on tile 0,4 in a 16x16 bitboard.");
+    assert(bitboard_get(&bitboard16, 1, 4) == EMPTY, "Incorrect player returned on tile 1,4 in a 16x16 bitboard.");
+}
+
+void test_bitboard_set(void) {
+    BitBoard bitboard5 = bitboard_create(5);
+
+    bitboard_set(&bitboard5, 4, 4, X);
+    assert(bitboard5.player_one_board[0] == (uint64_t)1 << 24, "Tile set incorrectly at 4,4 in a 5x5 bitboard.");
+    bitboard_set(&bitboard5, 4, 4, EMPTY);
+    assert(bitboard5.player_one_board[0] == 0, "Tile cleared incorrectly at 4,4 in a 5x5 bitboard.");
+    bitboard_set(&bitboard5, 1, 0, O);
+    assert(bitboard5.player_two_board[0] == 0b10, "Tile set incorrectly at 1,0 in a 5x5 bitboard.");
+}
+
+void test_bitboard_occupancy(void) {
+    BitBoard bitboard12 = bitboard_create(12);
+    bitboard_set(&bitboard12, 3, 0, X);
+    bitboard_set(&bitboard12, 11, 11, O);
+    bitboard_set(&bitboard12, 6, 7, X);
+
+    assert(bitboard_is_occupied(&bitboard12, 3), "Tile 3,0 should be occupied in a 12x12 bitboard.");
+    assert(bitboard_is_occupied(&bitboard12, 143), "Tile 11,11 should be occupied in a 12x12 bitboard.");
+    assert(!bitboard_is_occupied(&bitboard12, 4), "Tile 4,0 should be empty in a 12x12 bitboard.");
+    assert(bitboard_count_occupied(&bitboard12) == 3, "Occupied tiles counted incorrectly in a 12x12 bitboard.");
+}
+
+void test_bitboard_find_patterns(void) {
+    Board* board5 = board_create(5);
+    // horizontal XOX from 0,0; vertical OXO from 4,1; diagonal XOX from 0,2 and anti-diagonal XOX from 4,2
+    board_from_string(board5, "XOX__" "____O" "X___X" "_O_OO" "__X__");
+    const BitBoard bitboard5 = bitboard_from_board(board5);
+
+    uint64_t patterns[NUM_LINE_DIRECTIONS][BITBOARD_MAX_WORDS];
+    bitboard_find_patterns(&bitboard5, patterns);
+    assert(patterns[HORIZONTAL][0] == (uint64_t)1 << 0, "Horizontal patterns found incorrectly on a 5x5 board.");
+    assert(patterns[VERTICAL][0] == (uint64_t)1 << 9, "Vertical patterns found incorrectly on a 5x5 board.");
+    assert(patterns[DIAGONAL][0] == (uint64_t)1 << 10, "Diagonal patterns found incorrectly on a 5x5 board.");
+    assert(patterns[ANTI_DIAGONAL][0] == (uint64_t)1 << 14, "Anti-diagonal patterns found incorrectly on a 5x5 board.");
+    board_free(board5);
+    board5 = NULL;
+
+    // a pattern crossing the word boundary of a 16x16 board (tiles 47, 63 and 79)
+    BitBoard bitboard16 = bitboard_create(16);
+    bitboard_set(&bitboard16, 15, 2, O);
+    bitboard_set(&bitboard16, 15, 3, X);
+    bitboard_set(&bitboard16, 15, 4, O);
+    bitboard_find_patterns(&bitboard16, patterns);
+    assert(patterns[VERTICAL][0] == (uint64_t)1 << 47, "Vertical pattern across words not found on a 16x16 board.");
+    assert(patterns[HORIZONTAL][0] == 0 && patterns[DIAGONAL][0] == 0 && patterns[ANTI_DIAGONAL][0] == 0,
+           "False-positive patterns found on a 16x16 board.");
+}
+
+void test_bitboard_is_win(void) {
+    // no patterns
+    Board* board3 = board_create(3);
+    board_from_string(board3, "XX_OO___O");
+    BitBoard bitboard3 = bitboard_from_board(board3);
+    assert(!bitboard_is_win(&bitboard3), "False-positive win detected on a 3x3 bitboard.");
+    bitboard_set(&bitboard3, 0, 2, X);
+    assert(bitboard_is_win(&bitboard3), "Win wasn't detected on a 3x3 bitboard.");
+    board_free(board3);
+    board3 = NULL;
+
+    // marks that are consecutive in memory but wrap around the board edge
+    Board* board4 = board_create(4);
+    board_from_string(board4, "__XO" "X___" "_O__" "X___");
+    const BitBoard bitboard4 = bitboard_from_board(board4);
+    assert(!bitboard_is_win(&bitboard4), "Pattern wrapping around the board edge was detected as a win.");
+    board_free(board4);
+    board4 = NULL;
+
+    // a diagonal win in the last word of a 12x12 board
+    BitBoard bitboard12 = bitboard_create(12);
+    bitboard_set(&bitboard12, 9, 9, X);
+    bitboard_set(&bitboard12, 10, 10, O);
+    assert(!bitboard_is_win(&bitboard12), "False-positive win detected on a 12x12 bitboard.");
+    bitboard_set(&bitboard12, 11, 11, X);
+    assert(bitboard_is_win(&bitboard12), "Diagonal win wasn't detected on a 12x12 bitboard.");
+}
@@ -0,0 +1,24 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_BITBOARD_H
+#define TEST_BITBOARD_H
+
+void test_bitboard_init(void);
+
+void test_bitboard_from_board(void);
+
+void test_bitboard_to_board(void);
+
+void test_bitboard_get(void);
+
+void test_bitboard_set(void);
+
+void test_bitboard_occupancy(void);
+
+void test_bitboard_find_patterns(void);
+
+void test_bitboard_is_win(void);
+
+#endif //TEST_BITBOARD_H
@@ -8,6 +8,7 @@
 #include <string.h>
 
 #include "board.h"
+#include "unchecked.h"
 #include "utils/functions/std_utils.h"
 
 void test_board_init(void) {
@@ -24,8 +25,8 @@ void test_board_init(void) {
     Board* board4 = board_create(4);
     assert(board4->player_one_board->size == 16, "Player one bitboard size is not 16.");
     assert(board4->player_two_board->size == 16, "Player two bitboard size is not 16.");
-    assert(board4->player_one_board->bits[1] == 0, "Player one bitboard of size 4x4 was not initialized correctly.");
-    assert(board4->player_two_board->bits[1] == 0, "Player two bitboard of size 4x4 was not initialized correctly.");
+    assert(board4->player_one_board->bits[0] == 0, "Player one bitboard of size 4x4 was not initialized correctly.");
+    assert(board4->player_two_board->bits[0] == 0, "Player two bitboard of size 4x4 was not initialized correctly.");
     board_free(board4);
     board4 = NULL;
 }
@@ -57,6 +58,23 @@ void test_board_clone(void) {
     board5_clone = NULL;
 }
 
+void test_board_copy_into(void) {
+    Board* board4 = board_create(4);
+    Board* target4 = board_create(4);
+    board_from_string(board4, "X__O_OX____X____");
+    board_from_string(target4, "OOOOOOOOOOOOOOOO");
+    board_copy_into(target4, board4);
+
+    char buffer[17];
+    board_to_string(target4, buffer);
+    assert(strcmp(buffer, "X__O_OX____X____") == 0, "4x4 board wasn't copied correctly.");
+
+    board_free(board4);
+    board_free(target4);
+    board4 = NULL;
+    target4 = NULL;
+}
+
 void test_board_get(void) {
     Board* board3 = board_create(3);
     bitset_from_string(board3->player_one_board, "100010001");
@@ -68,18 +86,45 @@ void test_board_get(void) {
     board3 = NULL;
 }
 
+void test_board_get_index(void) {
+    Board* board3 = board_create(3);
+    bitset_from_string(board3->player_one_board, "100010001");
+    bitset_from_string(board3->player_two_board, "001001000");
+    assert(board_get_index(board3, 8) == X, "Incorrect player returned on tile index 8 in a 3x3 board.");
+    assert(board_get_index(board3, 1) == EMPTY, "Incorrect player returned on tile index 1 in a 3x3 board.");
+    assert(board_get_index(board3, 5) == O, "Incorrect player returned on tile index 5 in a 3x3 board.");
+    board_free(board3);
+    board3 = NULL;
+}
+
 void test_board_set(void) {
     Board* board5 = board_create(5);
     board_set(board5, 4, 4, X);
-    assert(board5->player_one_board->bits[3] == 0b00000001, "Tile set incorrectly at 4,4 in a 5x5 board.");
+    assert(board5->player_one_board->bits[0] == 1 << 24, "Tile set incorrectly at 4,4 in a 5x5 board.");
     board_set(board5, 4, 4, EMPTY);
-    assert(board5->player_one_board->bits[3] == 0, "Tile cleared incorrectly at 4,4 in a 5x5 board.");
+    assert(board5->player_one_board->bits[0] == 0, "Tile cleared incorrectly at 4,4 in a 5x5 board.");
     board_set(board5, 0, 0, O);
     assert(board5->player_two_board->bits[0] == 0b00000001, "Tile set incorrectly at 0,0 in a 5x5 board.");
     board_free(board5);
     board5 = NULL;
 }
 
+void test_board_unchecked(void) {
+    Board* board = board_create(5);
+    board_from_string(board, "X___O____________________");
+
+    assert(board_get_unchecked(board, 0, 0) == X, "Unchecked get didn't find X at 0,0.");
+    assert(board_get_unchecked(board, 4, 0) == O, "Unchecked get didn't find O at 4,0.");
+    assert(board_get_index_unchecked(board, 24) == EMPTY, "Unchecked get found a mark on an empty tile.");
+
+    board_set_unchecked(board, 4, 4, O);
+    assert(board_get(board, 4, 4) == O, "Unchecked set placed the mark incorrectly.");
+    board_set_unchecked(board, 0, 0, EMPTY);
+    assert(board->player_one_board->bits[0] == 0, "Unchecked set didn't clear the tile.");
+
+    board_free(board);
+}
+
 void test_board_coordinates_in_bounds(void) {
     Board* board12 = board_create(12);
     assert(board_coordinates_in_bounds(board12, -1, 0) == false,
@@ -107,7 +152,8 @@ void test_board_get_legal_moves(void) {
 
     // get the legal moves
     uint8_t move_array[4][2];
-    board_get_legal_moves(move_array, board3);
+    const uint16_t num_moves = board_get_legal_moves(move_array, board3);
+    assert(num_moves == 4, "Function returned an incorrect number of legal moves for a 3x3 board position.");
     const uint8_t correct_move_array[4][2] = {
         {0, 0},
         {1, 0},
@@ -121,6 +167,41 @@ void test_board_get_legal_moves(void) {
 
     board_free(board3);
     board3 = NULL;
+
+    // 9x9 board, the empty tiles span two words (index 1 is in the first word, index 80 in the second)
+    Board* board9 = board_create(9);
+    for (uint8_t y = 0; y < 9; y++) {
+        for (uint8_t x = 0; x < 9; x++) {
+            if (!(x == 1 && y == 0) && !(x == 8 && y == 8)) {
+                board_set(board9, x, y, (x + y) % 2 == 0 ? X : O);
+            }
+        }
+    }
+
+    uint8_t move_array9[81][2];
+    const uint16_t num_moves9 = board_get_legal_moves(move_array9, board9);
+    assert(num_moves9 == 2, "Function returned an incorrect number of legal moves for a 9x9 board position.");
+    assert(move_array9[0][0] == 1 && move_array9[0][1] == 0, "First legal move of a 9x9 board position is incorrect.");
+    assert(move_array9[1][0] == 8 && move_array9[1][1] == 8, "Last legal move of a 9x9 board position is incorrect.");
+
+    board_free(board9);
+    board9 = NULL;
+}
+
+void test_board_get_legal_tiles(void) {
+    Board* board3 = board_create(3);
+    board_from_string(board3, "__XXOX_O_");
+
+    uint16_t tile_array[9];
+    const uint16_t num_moves = board_get_legal_tiles(tile_array, board3);
+    const uint16_t correct_tile_array[4] = {0, 1, 6, 8};
+
+    assert(num_moves == 4, "Function returned an incorrect number of legal tiles for a 3x3 board position.");
+    assert(memcmp(tile_array, correct_tile_array, sizeof(correct_tile_array)) == 0,
+           "Function provided incorrect legal tiles for a 3x3 board position.");
+
+    board_free(board3);
+    board3 = NULL;
 }
 
 void test_board_shuffle_moves(void) {
@@ -156,6 +237,36 @@ void test_board_shuffle_moves(void) {
     }
 }
 
+void test_board_shuffle_moves_rng(void) {
+    uint8_t move_array[16][2];
+    uint8_t same_seed_array[16][2];
+    for (uint8_t i = 0; i < 16; i++) {
+        move_array[i][0] = i;
+        move_array[i][1] = 15 - i;
+    }
+    memcpy(same_seed_array, move_array, sizeof(move_array));
+
+    Rng rng;
+    Rng same_rng;
+    rng_seed(&rng, 3);
+    rng_seed(&same_rng, 3);
+    board_shuffle_moves_rng(move_array, 16, &rng);
+    board_shuffle_moves_rng(same_seed_array, 16, &same_rng);
+
+    // the shuffle is reproducible and keeps every move exactly once
+    assert(memcmp(move_array, same_seed_array, sizeof(move_array)) == 0,
+           "Shuffles with equally seeded generators differ.");
+
+    bool present[16] = {false};
+    for (uint8_t i = 0; i < 16; i++) {
+        assert(move_array[i][0] + move_array[i][1] == 15, "Shuffle separated the coordinates of a move.");
+        present[move_array[i][0] % 16] = true;
+    }
+    for (uint8_t i = 0; i < 16; i++) {
+        assert(present[i], "One of the moves wasn't included in the shuffled array.");
+    }
+}
+
 void test_board_to_string(void) {
     // 2x2 board
     Board* board2 = board_create(2);
@@ -193,13 +304,9 @@ void test_board_from_string(void) {
     Board* board3 = board_create(3);
     board_from_string(board3, "XO_X__O__");
     assert(board3->player_one_board->bits[0] == 0b00001001,
-           "Xs recorded incorrectly in the first byte while creating a 3x3 board from a string.");
-    assert(board3->player_one_board->bits[1] == 0,
-           "Xs recorded incorrectly in the second byte while creating a 3x3 board from a string.");
+           "Xs recorded incorrectly while creating a 3x3 board from a string.");
     assert(board3->player_two_board->bits[0] == 0b01000010,
-           "Os recorded incorrectly in the first byte while creating a 3x3 board from a string.");
-    assert(board3->player_two_board->bits[1] == 0,
-           "Os recorded incorrectly in the second byte while creating a 3x3 board from a string.");
+           "Os recorded incorrectly while creating a 3x3 board from a string.");
     board_free(board3);
     board3 = NULL;
 }
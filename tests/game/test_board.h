@@ -9,16 +9,26 @@ void test_board_init(void);
 
 void test_board_clone(void);
 
+void test_board_copy_into(void);
+
 void test_board_get(void);
 
+void test_board_get_index(void);
+
 void test_board_set(void);
 
+void test_board_unchecked(void);
+
 void test_board_coordinates_in_bounds(void);
 
 void test_board_get_legal_moves(void);
 
+void test_board_get_legal_tiles(void);
+
 void test_board_shuffle_moves(void);
 
+void test_board_shuffle_moves_rng(void);
+
 void test_board_to_string(void);
 
 void test_board_from_string(void);
@@ -8,6 +8,7 @@
 #include <string.h>
 
 #include "game.h"
+#include "unchecked.h"
 #include "utils/functions/std_utils.h"
 
 void test_game_clone(void) {
@@ -35,6 +36,79 @@ void test_game_clone(void) {
     clone = NULL;
 }
 
+void test_game_copy_into(void) {
+    const char* repr = "__X___O_______X_O__X_____";
+
+    Game* game = game_create(5);
+    board_from_string(game->board, repr);
+    game->current_player = O;
+    game->last_x = 2;
+    game->last_y = 0;
+    game->turns_taken = 5;
+    Game* target = game_create(5);
+    game_move(target, 4, 4);
+    game_copy_into(target, game);
+
+    char buffer[26];
+    board_to_string(target->board, buffer);
+    assert(strcmp(repr, buffer) == 0, "Board representation is incorrect after copying a game.");
+    assert(target->current_player == O, "Current player is incorrect after copying a game.");
+    assert(target->last_x == 2 && target->last_y == 0, "Last move is incorrect after copying a game.");
+    assert(target->turns_taken == 5, "Number of turns taken is incorrect after copying a game.");
+
+    game_free(game);
+    game_free(target);
+    game = NULL;
+    target = NULL;
+}
+
+void test_game_create_in(void) {
+    OxoxArena* arena = oxox_arena_create(1024);
+    Game* game = game_create_in(arena, 6);
+
+    char repr[37];
+    board_to_string(game->board, repr);
+    assert(strcmp(repr, "____________________________________") == 0, "Game created in an arena isn't empty.");
+    assert(game->current_player == X && game->turns_taken == 0, "Game created in an arena isn't initialized.");
+
+    // the game is playable like any other
+    game_move(game, 1, 1);
+    game_move(game, 2, 2);
+    game_move(game, 3, 3);
+    assert(game_is_win(game), "Win not detected in a game created in an arena.");
+
+    oxox_arena_free(arena);
+    arena = NULL;
+}
+
+void test_game_clone_in(void) {
+    const char* repr = "__X___O_______X_O__X_____";
+    OxoxArena* arena = oxox_arena_create(256);
+
+    // clone a heap-allocated game
+    Game* game = game_create(5);
+    board_from_string(game->board, repr);
+    game->current_player = O;
+    game->turns_taken = 5;
+    Game* clone = game_clone_in(arena, game);
+
+    // clone the arena game (the fast path)
+    Game* second_clone = game_clone_in(arena, clone);
+    game_move(clone, 0, 0);
+
+    char buffer[26];
+    board_to_string(second_clone->board, buffer);
+    assert(strcmp(repr, buffer) == 0, "Board representation is incorrect after cloning a game in an arena.");
+    assert(second_clone->current_player == O, "Current player is incorrect after cloning a game in an arena.");
+    assert(second_clone->turns_taken == 5, "Number of turns taken is incorrect after cloning a game in an arena.");
+    assert(!game->in_arena && clone->in_arena && second_clone->in_arena, "Arena games aren't marked correctly.");
+
+    game_free(game);
+    oxox_arena_free(arena);
+    game = NULL;
+    arena = NULL;
+}
+
 void test_game_move(void) {
     Game* game = game_create(6);
 
@@ -71,6 +145,156 @@ void test_game_un_move(void) {
     game = NULL;
 }
 
+void test_game_move_unchecked(void) {
+    // the unchecked moves have to produce exactly the same games as the checked ones
+    Game* checked = game_create(5);
+    Game* unchecked = game_create(5);
+    const uint8_t moves[][2] = {{2, 2}, {0, 4}, {4, 1}, {3, 3}, {1, 0}};
+
+    for (int i = 0; i < 5; i++) {
+        game_move(checked, moves[i][0], moves[i][1]);
+        game_move_unchecked(unchecked, moves[i][0], moves[i][1]);
+    }
+
+    assert(bitset_equals(checked->board->player_one_board, unchecked->board->player_one_board) &&
+           bitset_equals(checked->board->player_two_board, unchecked->board->player_two_board),
+           "Unchecked moves placed different marks.");
+    assert(checked->turns_taken == unchecked->turns_taken && checked->current_player == unchecked->current_player &&
+           checked->last_x == unchecked->last_x && checked->last_y == unchecked->last_y,
+           "Unchecked moves left a different game state.");
+    assert(checked->hash == unchecked->hash, "Unchecked moves produced a different hash.");
+
+    for (int i = 4; i >= 0; i--) {
+        game_un_move_unchecked(unchecked, moves[i][0], moves[i][1]);
+    }
+
+    assert(unchecked->board->player_one_board->bits[0] == 0 && unchecked->board->player_two_board->bits[0] == 0,
+           "Unchecked un-moves left marks on the board.");
+    assert(unchecked->turns_taken == 0 && unchecked->current_player == X && unchecked->hash == game_compute_hash(unchecked),
+           "Unchecked un-moves didn't restore the empty game.");
+
+    game_free(checked);
+    game_free(unchecked);
+}
+
+void test_game_history(void) {
+    Game* game = game_create(3);
+    game_move(game, 1, 1); // not recorded, the history isn't enabled yet
+    game_enable_history(game);
+    assert(game->history != NULL && game->history_length == 0, "History wasn't enabled.");
+
+    // O at (0, 0) and (2, 0) with X at (1, 0) in between completes OXO, the previous position isn't won
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+    game_move(game, 2, 1);
+    const uint64_t hash_before = game->hash;
+    game_move(game, 0, 2);
+    game_move_unchecked(game, 2, 0);
+    assert(game->history_length == 5, "History has an incorrect number of moves.");
+    assert(game_is_win(game), "Position with OXO isn't won.");
+
+    game_undo(game);
+    assert(game->last_x == 0 && game->last_y == 2, "Undo didn't restore the previous last move.");
+    assert(!game_is_win(game), "Position is still won after the undo.");
+    assert(board_get(game->board, 2, 0) == EMPTY && game->current_player == O, "Undo didn't revert the move.");
+
+    // game_un_move restores the last move as well
+    game_un_move(game, 0, 2);
+    assert(game->last_x == 2 && game->last_y == 1 && game->hash == hash_before,
+           "Un-move with history restored an incorrect state.");
+    assert(game->turns_taken == 4 && game->history_length == 3, "Un-move with history has incorrect counts.");
+
+    // clones and copies keep the history
+    Game* clone = game_clone(game);
+    assert(clone->history != NULL && clone->history != game->history && clone->history_length == 3,
+           "Clone didn't copy the history.");
+    game_undo(clone);
+    game_undo(clone);
+    game_undo(clone);
+    assert(clone->last_x == 1 && clone->last_y == 1 && clone->turns_taken == 1, "Clone's history is incorrect.");
+
+    // the moves from before the history fall back to resetting the last move
+    game_un_move_unchecked(clone, 1, 1);
+    assert(clone->last_x == 0 && clone->last_y == 0 && clone->turns_taken == 0, "Un-move without history failed.");
+
+    game_copy_into(clone, game);
+    assert(clone->history_length == 3 && clone->history[1].tile == 1, "Copy didn't copy the history.");
+
+    Game* plain = game_create(3);
+    game_copy_into(clone, plain);
+    assert(clone->history != NULL && clone->history_length == 0, "Copy from a game without history kept moves.");
+
+    game_disable_history(game);
+    assert(game->history == NULL && game->history_length == 0, "History wasn't disabled.");
+    game_un_move(game, 2, 1);
+    assert(game->last_x == 0 && game->last_y == 0, "Un-move without history didn't reset the last move.");
+
+    game_free(game);
+    game_free(clone);
+    game_free(plain);
+    game = NULL;
+    clone = NULL;
+    plain = NULL;
+}
+
+void test_game_hash(void) {
+    Game* game = game_create(6);
+    assert(game->hash == game_compute_hash(game), "Hash of an empty game is incorrect.");
+
+    game_move(game, 2, 0);
+    game_move(game, 5, 5);
+    game_move(game, 3, 2);
+    assert(game->hash == game_compute_hash(game), "Hash wasn't updated correctly by game_move.");
+
+    // the same position reached by a different move order has the same hash
+    Game* transposed = game_create(6);
+    game_move(transposed, 3, 2);
+    game_move(transposed, 5, 5);
+    game_move(transposed, 2, 0);
+    assert(transposed->hash == game->hash, "Transposed positions have different hashes.");
+
+    // un-moving restores the previous hash, the side to move is part of it
+    const uint64_t hash_before = game->hash;
+    game_move(game, 0, 0);
+    assert(game->hash != hash_before, "Hash didn't change after a move.");
+    game_un_move(game, 0, 0);
+    assert(game->hash == hash_before, "Hash wasn't restored by game_un_move.");
+    game_un_move(game, 3, 2);
+    assert(game->hash == game_compute_hash(game), "Hash wasn't updated correctly by game_un_move.");
+
+    // the same marks with a different player to move don't collide
+    Game* edited = game_create(6);
+    board_from_string(edited->board, "X_X__________O______________________");
+    const uint64_t x_to_move = game_compute_hash(edited);
+    edited->current_player = O;
+    assert(game_compute_hash(edited) != x_to_move, "Hash doesn't depend on the side to move.");
+
+    Game* clone = game_clone(game);
+    assert(clone->hash == game->hash, "Hash is incorrect after cloning a game.");
+
+    // the same marks on boards of different sizes don't collide
+    Game* small = game_create(3);
+    Game* large = game_create(4);
+    assert(small->hash != large->hash, "Empty boards of different sizes have the same hash.");
+    game_move(small, 0, 0);
+    game_move(large, 0, 0);
+    assert(small->hash != large->hash, "Same marks on boards of different sizes have the same hash.");
+    assert(small->hash == game_compute_hash(small), "Hash of a 3x3 game is incorrect.");
+
+    game_free(game);
+    game_free(transposed);
+    game_free(edited);
+    game_free(clone);
+    game_free(small);
+    game_free(large);
+    game = NULL;
+    transposed = NULL;
+    edited = NULL;
+    clone = NULL;
+    small = NULL;
+    large = NULL;
+}
+
 void test_game_is_tie(void) {
     // 3x3 board
     Game* game3 = game_create(3);
@@ -124,6 +348,40 @@ void test_game_is_win(void) {
 
     game_free(game4);
     game4 = NULL;
+
+    // 30x30 board, lines through the corner are clipped by the board edge
+    Game* game30 = game_create(30);
+    game_move(game30, 29, 27);
+    game_move(game30, 29, 28);
+    game_move(game30, 0, 0);
+    game_move(game30, 1, 0);
+    assert(!game_is_win(game30), "False-positive win detected in the corner of a 30x30 board.");
+    game_move(game30, 29, 29);
+    assert(game_is_win(game30), "Win in the corner of a 30x30 board not detected.");
+
+    game_free(game30);
+    game30 = NULL;
+}
+
+void test_game_is_win_full(void) {
+    // 3x3 board, the last move isn't part of the pattern
+    Game* game3 = game_create(3);
+    board_from_string(game3->board, "OX_XOX__O");
+    game3->last_x = 2;
+    game3->last_y = 2;
+    assert(game_is_win_full(game3), "Win on a 3x3 board not detected regardless of the last move.");
+    game_free(game3);
+    game3 = NULL;
+
+    // 20x20 board (too large for a bitboard)
+    Game* game20 = game_create(20);
+    game_move(game20, 19, 17);
+    game_move(game20, 18, 18);
+    assert(!game_is_win_full(game20), "False-positive win detected on a 20x20 board.");
+    game_move(game20, 17, 19);
+    assert(game_is_win_full(game20), "Anti-diagonal win not detected on a 20x20 board.");
+    game_free(game20);
+    game20 = NULL;
 }
 
 void test_game_full_suite(void) {
@@ -195,6 +453,36 @@ void test_game_random_play(void) {
     different_game = NULL;
 }
 
+void test_game_random_play_rng(void) {
+    Game* game = game_create(8);
+    Game* shuffled_game = game_create(8);
+    uint8_t move_buffer[64][2];
+
+    // the lazily drawn play must be the same as playing a fully shuffled move list with the same seed
+    Rng rng;
+    rng_seed(&rng, 17);
+    const float value = game_random_play_rng(game, move_buffer, &rng);
+
+    rng_seed(&rng, 17);
+    board_get_legal_moves(move_buffer, shuffled_game->board);
+    board_shuffle_moves_rng(move_buffer, 64, &rng);
+    for (uint16_t i = 0; i < 64 && !game_is_win_full(shuffled_game); i++) {
+        game_move(shuffled_game, move_buffer[i][0], move_buffer[i][1]);
+    }
+
+    char repr[65];
+    char shuffled_repr[65];
+    board_to_string(game->board, repr);
+    board_to_string(shuffled_game->board, shuffled_repr);
+    assert(strcmp(repr, shuffled_repr) == 0, "Lazy random play doesn't match the fully shuffled play.");
+    assert(value == 0 ? game_is_tie(game) : game_is_win(game), "Lazy random play returned an incorrect result.");
+
+    game_free(game);
+    game_free(shuffled_game);
+    game = NULL;
+    shuffled_game = NULL;
+}
+
 void test_game_rollout(void) {
     // because the process is random, the tests are pretty much just confirming the function runs without errors
     srand(1);
@@ -204,3 +492,69 @@ void test_game_rollout(void) {
     game_free(game);
     game = NULL;
 }
+
+void test_game_rollout_with_scratch(void) {
+    Game* game = game_create(7);
+    game_move(game, 3, 3);
+    RolloutScratch* scratch = rollout_scratch_create(7);
+
+    // the scratch version has to match the allocating one for the same seed
+    srand(5);
+    const float expected = game_rollout(game, 50);
+    srand(5);
+    const float result = game_rollout_with_scratch(game, 50, scratch);
+    assert(result == expected, "Rollout with scratch memory doesn't match a regular rollout.");
+
+    // the scratch can be reused for more rollouts and the position stays untouched
+    const float second_result = game_rollout_with_scratch(game, 50, scratch);
+    assert(-1 <= second_result && second_result <= 1, "Game position value from a reused scratch is out of bounds.");
+    assert(game->turns_taken == 1, "Rollout with scratch memory modified the starting position.");
+
+    rollout_scratch_free(scratch);
+    game_free(game);
+    scratch = NULL;
+    game = NULL;
+}
+
+void test_game_rollout_rng(void) {
+    Game* game = game_create(5);
+    RolloutScratch* scratch = rollout_scratch_create(5);
+
+    // equally seeded generators give the same estimate, regardless of rand()
+    Rng rng;
+    rng_seed(&rng, 11);
+    srand(1);
+    const float result = game_rollout_rng(game, 200, scratch, &rng);
+    rng_seed(&rng, 11);
+    srand(2);
+    const float repeated_result = game_rollout_rng(game, 200, scratch, &rng);
+
+    assert(-1 <= result && result <= 1, "Game position value from a seeded rollout is out of bounds.");
+    assert(result == repeated_result, "Seeded rollout isn't reproducible.");
+
+    rollout_scratch_free(scratch);
+    game_free(game);
+    scratch = NULL;
+    game = NULL;
+}
+
+void test_game_rollout_parallel(void) {
+    Game* game = game_create(8);
+    game_move(game, 4, 4);
+
+    // the same seed and number of threads always give the same result
+    const float result = game_rollout_parallel(game, 400, 4, 42);
+    const float repeated_result = game_rollout_parallel(game, 400, 4, 42);
+    assert(-1 <= result && result <= 1, "Game position value from a parallel rollout is out of bounds.");
+    assert(result == repeated_result, "Parallel rollout isn't deterministic for the same seed and thread count.");
+
+    // more threads than iterations and a single thread both work
+    const float few_iterations = game_rollout_parallel(game, 3, 8, 7);
+    const float single_thread = game_rollout_parallel(game, 100, 1, 7);
+    assert(-1 <= few_iterations && few_iterations <= 1, "Parallel rollout with idle threads is out of bounds.");
+    assert(-1 <= single_thread && single_thread <= 1, "Single-threaded parallel rollout is out of bounds.");
+    assert(game->turns_taken == 1, "Parallel rollout modified the starting position.");
+
+    game_free(game);
+    game = NULL;
+}
@@ -7,18 +7,40 @@
 
 void test_game_clone(void);
 
+void test_game_copy_into(void);
+
+void test_game_create_in(void);
+
+void test_game_clone_in(void);
+
 void test_game_move(void);
 
 void test_game_un_move(void);
 
+void test_game_move_unchecked(void);
+
+void test_game_history(void);
+
+void test_game_hash(void);
+
 void test_game_is_tie(void);
 
 void test_game_is_win(void);
 
+void test_game_is_win_full(void);
+
 void test_game_full_suite(void);
 
 void test_game_random_play(void);
 
+void test_game_random_play_rng(void);
+
 void test_game_rollout(void);
 
+void test_game_rollout_with_scratch(void);
+
+void test_game_rollout_rng(void);
+
+void test_game_rollout_parallel(void);
+
 #endif //TEST_GAME_H
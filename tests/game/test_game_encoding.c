@@ -0,0 +1,194 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_game_encoding.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "game_encoding.h"
+#include "utils/functions/std_utils.h"
+
+/**
+ * Check that two games hold the same position, including the hash.
+ */
+static bool games_equal(const Game* first, const Game* second) {
+    return bitset_equals(first->board->player_one_board, second->board->player_one_board) &&
+           bitset_equals(first->board->player_two_board, second->board->player_two_board) &&
+           first->turns_taken == second->turns_taken && first->last_x == second->last_x &&
+           first->last_y == second->last_y && first->current_player == second->current_player &&
+           first->hash == second->hash;
+}
+
+void test_game_encode(void) {
+    assert(game_encoded_size(3) == 12, "Encoded 3x3 position has an incorrect size.");
+    assert(game_encoded_size(8) == 24, "Encoded 8x8 position has an incorrect size.");
+    assert(game_encoded_size(20) == 108, "Encoded 20x20 position has an incorrect size.");
+
+    // tile i is bit i % 8 of byte i / 8
+    Game* game = game_create(3);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+    game_move(game, 2, 2);
+    uint8_t buffer[12];
+    assert(game_encode(game, buffer) == 12, "Encoding wrote an incorrect number of bytes.");
+    assert(buffer[0] == GAME_ENCODING_VERSION && buffer[1] == 3, "Header has an incorrect version or board size.");
+    assert(buffer[2] == 3 && buffer[3] == 0, "Header has an incorrect number of turns.");
+    assert(buffer[4] == 2 && buffer[5] == 2 && buffer[6] == O, "Header has an incorrect last move or player.");
+    assert(buffer[8] == 0x01 && buffer[9] == 0x01, "Tiles of X are encoded incorrectly.");
+    assert(buffer[10] == 0x02 && buffer[11] == 0x00, "Tiles of O are encoded incorrectly.");
+
+    Game* decoded = game_create(3);
+    game_decode(decoded, buffer);
+    assert(games_equal(game, decoded), "Decoded 3x3 position doesn't match the original.");
+
+    // positions spanning several words round-trip with the same hash
+    const uint8_t sizes[] = {8, 9, 20};
+    Rng rng;
+    rng_seed(&rng, 21);
+    for (size_t i = 0; i < sizeof(sizes); i++) {
+        Game* original = game_create(sizes[i]);
+        Game* copy = game_create(sizes[i]);
+        uint8_t* data = malloc(game_encoded_size(sizes[i]));
+
+        for (uint16_t turn = 0; turn < sizes[i] * sizes[i] / 2; turn++) {
+            uint16_t tiles[400];
+            const uint16_t num_tiles = board_get_legal_tiles(tiles, original->board);
+            const uint16_t tile = tiles[rng_below(&rng, num_tiles)];
+            game_move(original, tile % sizes[i], tile / sizes[i]);
+        }
+
+        game_encode(original, data);
+        game_decode(copy, data);
+        assert(games_equal(original, copy), "Decoded %dx%d position doesn't match the original.", sizes[i],
+               sizes[i]);
+        assert(copy->hash == game_compute_hash(copy), "Decoded %dx%d position has an incorrect hash.", sizes[i],
+               sizes[i]);
+
+        free(data);
+        game_free(original);
+        game_free(copy);
+    }
+
+    game_free(game);
+    game_free(decoded);
+    game = NULL;
+    decoded = NULL;
+}
+
+void test_game_encode_batch(void) {
+    Game* games[5];
+    Game* decoded[5];
+    for (uint8_t i = 0; i < 5; i++) {
+        games[i] = game_create(4);
+        decoded[i] = game_create(4);
+
+        // every game gets a different number of moves along the diagonal and the row below it
+        for (uint8_t j = 0; j < i; j++) {
+            game_move(games[i], j, j);
+            game_move(games[i], j, (j + 1) % 4);
+        }
+    }
+
+    const size_t record_size = game_encoded_size(4);
+    uint8_t buffer[5 * 12];
+    assert(record_size == 12, "Encoded 4x4 position has an incorrect size.");
+    assert(game_encode_batch((const Game* const*)games, 5, buffer) == 5 * record_size,
+           "Batch encoding wrote an incorrect number of bytes.");
+
+    // the records are the same as when encoded one by one
+    uint8_t single[12];
+    game_encode(games[3], single);
+    assert(memcmp(buffer + 3 * record_size, single, record_size) == 0, "Batch record doesn't match single encoding.");
+
+    game_decode_batch(decoded, 5, buffer);
+    for (uint8_t i = 0; i < 5; i++) {
+        assert(games_equal(games[i], decoded[i]), "Batch decoded position %d doesn't match the original.", i);
+    }
+
+    assert(game_encode_batch(NULL, 0, NULL) == 0, "Empty batch wrote some bytes.");
+
+    for (uint8_t i = 0; i < 5; i++) {
+        game_free(games[i]);
+        game_free(decoded[i]);
+        games[i] = NULL;
+        decoded[i] = NULL;
+    }
+}
+
+void test_game_encoding_verify(void) {
+    // X at 0,0 and 2,2, O at 1,0, O to move
+    Game* game = game_create(3);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+    game_move(game, 2, 2);
+    uint8_t valid[12];
+    game_encode(game, valid);
+    assert(game_encoding_verify(valid), "Encoded position of a game isn't valid.");
+
+    Game* empty = game_create(3);
+    uint8_t empty_buffer[12];
+    game_encode(empty, empty_buffer);
+    assert(game_encoding_verify(empty_buffer), "Encoded empty board isn't valid.");
+
+    uint8_t buffer[12];
+
+    // the number of turns doesn't match the marks
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[2] = 9;
+    assert(!game_encoding_verify(buffer), "Position with more turns than marks is valid.");
+
+    // X has one mark more, so O has to be the one to move
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[6] = X;
+    assert(!game_encoding_verify(buffer), "Position with the wrong player to move is valid.");
+
+    // X has two marks more than O
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[8] |= 0x10;
+    buffer[2] = 4;
+    assert(!game_encoding_verify(buffer), "Position with two extra marks of X is valid.");
+
+    // the last move is a mark of the player to move
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[4] = 1;
+    buffer[5] = 0;
+    assert(!game_encoding_verify(buffer), "Position with the last move of the player to move is valid.");
+
+    // the last move is an empty tile
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[4] = 1;
+    buffer[5] = 1;
+    assert(!game_encoding_verify(buffer), "Position with the last move on an empty tile is valid.");
+
+    // a tile marked by both players
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[10] |= 0x01;
+    assert(!game_encoding_verify(buffer), "Position with a tile marked twice is valid.");
+
+    // a mark past the last tile
+    memcpy(buffer, valid, sizeof(buffer));
+    buffer[11] |= 0x02;
+    assert(!game_encoding_verify(buffer), "Position with a mark past the last tile is valid.");
+
+    // game_un_move without a history resets the last move to (0, 0), an empty tile here
+    Game* taken_back = game_create(3);
+    Game* copy = game_create(3);
+    game_move(taken_back, 1, 1);
+    game_move(taken_back, 2, 2);
+    game_un_move(taken_back, 2, 2);
+    game_encode(taken_back, buffer);
+    assert(game_encoding_verify(buffer), "Position after an un-move isn't valid.");
+    game_decode(copy, buffer);
+    assert(games_equal(taken_back, copy), "Decoded position after an un-move doesn't match the original.");
+
+    game_free(game);
+    game_free(empty);
+    game_free(taken_back);
+    game_free(copy);
+    game = NULL;
+    empty = NULL;
+    taken_back = NULL;
+    copy = NULL;
+}
@@ -0,0 +1,14 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_GAME_ENCODING_H
+#define TEST_GAME_ENCODING_H
+
+void test_game_encode(void);
+
+void test_game_encode_batch(void);
+
+void test_game_encoding_verify(void);
+
+#endif //TEST_GAME_ENCODING_H
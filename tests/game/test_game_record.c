@@ -0,0 +1,152 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_game_record.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "game_record.h"
+#include "utils/functions/std_utils.h"
+
+void test_game_record_write_read(void) {
+    const char* path = "test_game_record_3x3.log";
+    remove(path);
+
+    // a won game, a draw and an empty game
+    const uint16_t won[] = {0, 4, 2, 1, 6, 3};
+    const uint16_t drawn[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    GameRecordWriter* writer = game_record_writer_open(path, 3);
+    game_record_write(writer, won, 6, 1);
+    game_record_write(writer, drawn, 9, 0);
+    game_record_write(writer, NULL, 0, 0);
+    game_record_writer_close(writer);
+
+    // appending keeps the existing records
+    writer = game_record_writer_open(path, 3);
+    game_record_write(writer, won, 3, -1);
+    game_record_writer_close(writer);
+
+    GameRecordReader* reader = game_record_reader_open(path);
+    assert(reader->board_size == 3, "Log has an incorrect board size.");
+
+    GameRecord record;
+    assert(game_record_next(reader, &record), "Log doesn't contain the first record.");
+    assert(record.num_moves == 6 && record.result == 1, "First record has incorrect moves or result.");
+    for (uint16_t i = 0; i < 6; i++) {
+        assert(game_record_tile(&record, i) == won[i], "First record has an incorrect tile at move %d.", i);
+    }
+    assert(game_record_verify(&record), "First record doesn't match its checksum.");
+
+    assert(game_record_next(reader, &record), "Log doesn't contain the second record.");
+    assert(record.num_moves == 9 && record.result == 0 && game_record_tile(&record, 8) == 8,
+           "Second record is incorrect.");
+    assert(game_record_next(reader, &record), "Log doesn't contain the empty record.");
+    assert(record.num_moves == 0 && game_record_verify(&record), "Empty record is incorrect.");
+    assert(game_record_next(reader, &record), "Log doesn't contain the appended record.");
+    assert(record.num_moves == 3 && record.result == -1, "Appended record is incorrect.");
+    assert(!game_record_next(reader, &record) && !reader->truncated, "Log has too many records.");
+    game_record_reader_close(reader);
+
+    // tiles take 2 bytes on boards with more than 256 tiles
+    const char* large_path = "test_game_record_20x20.log";
+    remove(large_path);
+    const uint16_t large_moves[] = {399, 0, 256, 255};
+    writer = game_record_writer_open(large_path, 20);
+    game_record_write(writer, large_moves, 4, 0);
+    game_record_writer_close(writer);
+
+    reader = game_record_reader_open(large_path);
+    assert(game_record_next(reader, &record), "Large log doesn't contain the record.");
+    for (uint16_t i = 0; i < 4; i++) {
+        assert(game_record_tile(&record, i) == large_moves[i], "Large record has an incorrect tile at move %d.", i);
+    }
+    game_record_reader_close(reader);
+
+    remove(path);
+    remove(large_path);
+}
+
+void test_game_record_replay(void) {
+    const char* path = "test_game_record_replay.log";
+    remove(path);
+
+    const uint16_t moves[] = {0, 4, 2, 1, 6, 3};
+    GameRecordWriter* writer = game_record_writer_open(path, 3);
+    game_record_write(writer, moves, 6, 1);
+    game_record_writer_close(writer);
+
+    GameRecordReader* reader = game_record_reader_open(path);
+    GameRecord record;
+    game_record_next(reader, &record);
+
+    // the replay matches playing the moves with game_move
+    Game* expected = game_create(3);
+    Game* game = game_create(3);
+    game_move(game, 1, 1); // overwritten by the replay
+    for (uint16_t i = 0; i < 6; i++) {
+        game_move(expected, moves[i] % 3, moves[i] / 3);
+    }
+    game_record_replay(game, &record, 6);
+    assert(bitset_equals(game->board->player_one_board, expected->board->player_one_board) &&
+           bitset_equals(game->board->player_two_board, expected->board->player_two_board),
+           "Replayed board doesn't match.");
+    assert(game->turns_taken == 6 && game->current_player == X && game->last_x == 0 && game->last_y == 1,
+           "Replayed game has incorrect fields.");
+    assert(game->hash == expected->hash, "Replayed game has an incorrect hash.");
+    assert(game_is_win(game), "Replayed game isn't won.");
+
+    // a prefix of the moves
+    game_record_replay(game, &record, 2);
+    assert(game->turns_taken == 2 && board_get(game->board, 1, 1) == O && board_get(game->board, 2, 0) == EMPTY,
+           "Partially replayed game is incorrect.");
+
+    // a changed tile no longer matches the checksum
+    GameRecord corrupted = record;
+    uint8_t tiles[6] = {0, 4, 2, 1, 6, 5};
+    corrupted.tiles = tiles;
+    assert(!game_record_verify(&corrupted), "Corrupted record matches its checksum.");
+
+    game_record_reader_close(reader);
+    game_free(expected);
+    game_free(game);
+    expected = NULL;
+    game = NULL;
+    remove(path);
+}
+
+void test_game_record_truncated(void) {
+    const char* path = "test_game_record_truncated.log";
+    remove(path);
+
+    const uint16_t moves[] = {0, 1, 2, 3, 4};
+    GameRecordWriter* writer = game_record_writer_open(path, 3);
+    game_record_write(writer, moves, 5, 0);
+    game_record_write(writer, moves, 4, 0);
+    game_record_writer_close(writer);
+
+    // cut the last record in half, as if the writer crashed
+    const long full_size = sizeof(GameRecordFileHeader) + 2 * sizeof(GameRecordHeader) + 9;
+    assert(truncate(path, full_size - 2) == 0, "Couldn't truncate the log.");
+
+    GameRecordReader* reader = game_record_reader_open(path);
+    GameRecord record;
+    assert(game_record_next(reader, &record) && record.num_moves == 5, "Intact record wasn't read.");
+    assert(!game_record_next(reader, &record) && reader->truncated, "Incomplete record wasn't detected.");
+    game_record_reader_close(reader);
+
+    // the writer removes the incomplete record before appending
+    writer = game_record_writer_open(path, 3);
+    game_record_write(writer, moves, 3, 1);
+    game_record_writer_close(writer);
+
+    reader = game_record_reader_open(path);
+    assert(game_record_next(reader, &record) && record.num_moves == 5, "Intact record was lost.");
+    assert(game_record_next(reader, &record) && record.num_moves == 3 && record.result == 1,
+           "Appended record wasn't read.");
+    assert(!game_record_next(reader, &record) && !reader->truncated, "Log has too many records.");
+    game_record_reader_close(reader);
+
+    remove(path);
+}
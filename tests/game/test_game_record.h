@@ -0,0 +1,14 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_GAME_RECORD_H
+#define TEST_GAME_RECORD_H
+
+void test_game_record_write_read(void);
+
+void test_game_record_replay(void);
+
+void test_game_record_truncated(void);
+
+#endif //TEST_GAME_RECORD_H
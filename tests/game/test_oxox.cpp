@@ -0,0 +1,143 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_oxox.h"
+
+#include "oxox.hpp"
+
+extern "C" {
+#include "utils/functions/std_utils.h"
+}
+
+// the tables are computed at compile time
+static_assert(oxox::detail::tables<3>.line_counts[4] == 4, "The center of a 3x3 board is in 4 lines.");
+static_assert(oxox::detail::tables<5>.line_counts[12] == 12, "The center of a 5x5 board is in 12 lines.");
+static_assert(oxox::Game<9>::num_words == 2, "A 9x9 board needs 2 words.");
+
+void test_oxox_move(void) {
+    oxox::Game<5> game;
+    game.move(2, 1);
+    game.move(24);
+
+    assert(game.get(2, 1) == X && game.get(4, 4) == O, "Moves placed the marks incorrectly.");
+    assert(game.turns_taken == 2 && game.current_player == X, "Moves didn't pass the turns.");
+    assert(game.last_x == 4 && game.last_y == 4, "Last move is incorrect.");
+
+    game.un_move(24);
+    game.un_move(7);
+    assert(game == oxox::Game<5>{}, "Un-moves didn't restore the empty game.");
+}
+
+/**
+ * Play the same random game in the C and the C++ game and compare the win checks after every move.
+ */
+template <uint8_t N>
+static bool win_checks_match(const uint64_t seed) {
+    Rng rng;
+    rng_seed(&rng, seed);
+    Game* c_game = game_create(N);
+    oxox::Game<N> game;
+    bool match = true;
+
+    std::array<uint16_t, oxox::Game<N>::num_tiles> tiles;
+    const uint16_t num_moves = game.get_legal_tiles(tiles);
+    for (uint16_t i = 0; i < num_moves; i++) {
+        std::swap(tiles[i], tiles[i + rng_below(&rng, num_moves - i)]);
+        game_move(c_game, tiles[i] % N, tiles[i] / N);
+        game.move(tiles[i]);
+
+        match &= game.is_win() == game_is_win(c_game);
+        match &= game.is_win_full() == game_is_win_full(c_game);
+        match &= game.is_tie() == game_is_tie(c_game);
+    }
+
+    game_free(c_game);
+    return match;
+}
+
+void test_oxox_is_win(void) {
+    oxox::Game<3> game;
+    game.move(0, 0);
+    game.move(1, 1);
+    assert(!game.is_win() && !game.is_win_full(), "Found a win without a pattern.");
+    game.move(2, 2);
+    assert(game.is_win() && game.is_win_full(), "Didn't find the XOX on the diagonal.");
+
+    // the sizes cover a single word, two words (the patterns cross the word boundary) and several words
+    for (uint64_t seed = 0; seed < 20; seed++) {
+        assert(win_checks_match<3>(seed), "Win checks differ from the C game on 3x3 (seed %llu).",
+               (unsigned long long)seed);
+        assert(win_checks_match<8>(seed), "Win checks differ from the C game on 8x8 (seed %llu).",
+               (unsigned long long)seed);
+        assert(win_checks_match<9>(seed), "Win checks differ from the C game on 9x9 (seed %llu).",
+               (unsigned long long)seed);
+        assert(win_checks_match<20>(seed), "Win checks differ from the C game on 20x20 (seed %llu).",
+               (unsigned long long)seed);
+    }
+}
+
+void test_oxox_conversion(void) {
+    Game* c_game = game_create(9);
+    game_move(c_game, 0, 0);
+    game_move(c_game, 8, 7);
+    game_move(c_game, 3, 4);
+
+    const oxox::Game<9> game = oxox::Game<9>::from_c(c_game);
+    assert(game.get(0, 0) == X && game.get(8, 7) == O && game.get(3, 4) == X, "Converted game has different marks.");
+    assert(game.turns_taken == 3 && game.current_player == O && game.last_x == 3 && game.last_y == 4,
+           "Converted game has different fields.");
+
+    Game* converted = game.to_c();
+    assert(bitset_equals(converted->board->player_one_board, c_game->board->player_one_board) &&
+           bitset_equals(converted->board->player_two_board, c_game->board->player_two_board),
+           "Game converted back has different marks.");
+    assert(converted->hash == c_game->hash, "Game converted back has a different hash.");
+    assert(converted->turns_taken == 3 && converted->current_player == O, "Game converted back has different fields.");
+
+    bool size_checked = false;
+    try {
+        oxox::Game<8>::from_c(c_game);
+    }
+    catch (const std::invalid_argument&) {
+        size_checked = true;
+    }
+    assert(size_checked, "A game of a different size was converted.");
+
+    game_free(c_game);
+    game_free(converted);
+}
+
+void test_oxox_random_play(void) {
+    // the moves are drawn the same way as in the C random play, so the same seed gives the same game
+    Rng rng;
+    Rng c_rng;
+    Game* empty = game_create(6);
+    Game* c_game = game_create(6);
+    uint8_t move_buffer[36][2];
+
+    for (uint64_t seed = 0; seed < 20; seed++) {
+        rng_seed(&rng, seed);
+        rng_seed(&c_rng, seed);
+        game_copy_into(c_game, empty);
+
+        oxox::Game<6> game;
+        const float result = game.random_play(rng);
+        const float c_result = game_random_play_rng(c_game, move_buffer, &c_rng);
+
+        assert(result == c_result, "Random play result differs from the C one (seed %llu).",
+               (unsigned long long)seed);
+        assert(game == oxox::Game<6>::from_c(c_game), "Random play ended differently than the C one (seed %llu).",
+               (unsigned long long)seed);
+    }
+
+    // a won position is lost for the player to move
+    oxox::Game<4> won;
+    won.move(0, 0);
+    won.move(1, 0);
+    won.move(2, 0);
+    assert(won.rollout(10, rng) == -1, "Rollout of a won position isn't -1.");
+
+    game_free(empty);
+    game_free(c_game);
+}
@@ -0,0 +1,16 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_OXOX_H
+#define TEST_OXOX_H
+
+void test_oxox_move(void);
+
+void test_oxox_is_win(void);
+
+void test_oxox_conversion(void);
+
+void test_oxox_random_play(void);
+
+#endif //TEST_OXOX_H
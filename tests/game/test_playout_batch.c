@@ -0,0 +1,79 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_playout_batch.h"
+
+#include <math.h>
+
+#include "playout_batch.h"
+#include "utils/functions/std_utils.h"
+
+void test_playout_batch_run(void) {
+    PlayoutBatch batch;
+    Rng rng;
+    rng_seed(&rng, 3);
+
+    // X fills the last tile and completes XOX in the middle row
+    Game* game = game_create(3);
+    board_from_string(game->board, "XXXXO_OOO");
+    game->turns_taken = 8;
+    assert(playout_batch_run(&batch, game, PLAYOUT_BATCH_LANES, &rng) == PLAYOUT_BATCH_LANES,
+           "Batch didn't win with the only move.");
+
+    // the last move doesn't complete anything
+    board_from_string(game->board, "_XXXXOOOO");
+    assert(playout_batch_run(&batch, game, 5, &rng) == 0, "Batch didn't draw a full board.");
+
+    // an already won position is lost for the player to move
+    board_from_string(game->board, "XOX______");
+    game->turns_taken = 3;
+    game->current_player = O;
+    assert(playout_batch_run(&batch, game, 3, &rng) == -3, "Batch didn't lose an already won position.");
+    assert(batch.results[0] == -1 && batch.results[2] == -1, "Batch has incorrect per-lane results.");
+
+    // every finished game contains a pattern or a full board
+    Game* empty = game_create(8);
+    playout_batch_run(&batch, empty, PLAYOUT_BATCH_LANES, &rng);
+    for (uint8_t lane = 0; lane < PLAYOUT_BATCH_LANES; lane++) {
+        const uint64_t occupied = batch.player_one_board[lane] | batch.player_two_board[lane];
+        assert(batch.results[lane] != 0 || occupied == UINT64_MAX, "Drawn lane doesn't have a full board.");
+        assert((batch.player_one_board[lane] & batch.player_two_board[lane]) == 0, "Lane has a tile marked twice.");
+
+        // X moves first, so X has the same number of marks as O or one more
+        const int difference =
+            __builtin_popcountll(batch.player_one_board[lane]) - __builtin_popcountll(batch.player_two_board[lane]);
+        assert(difference == 0 || difference == 1, "Lane has an incorrect number of marks.");
+    }
+
+    game_free(game);
+    game_free(empty);
+    game = NULL;
+    empty = NULL;
+}
+
+void test_game_rollout_batch(void) {
+    Game* game = game_create(5);
+    game_move(game, 2, 2);
+
+    // the batch plays from the same distribution as the one-by-one random play
+    Rng rng;
+    rng_seed(&rng, 11);
+    RolloutScratch* scratch = rollout_scratch_create(5);
+    const float batch_result = game_rollout_batch(game, 20000, &rng);
+    const float single_result = game_rollout_rng(game, 20000, scratch, &rng);
+    assert(fabsf(batch_result - single_result) < 0.05f, "Batch rollout differs from the one-by-one rollout.");
+
+    // the same seed gives the same result, also when the last batch isn't full
+    Rng first, second;
+    rng_seed(&first, 5);
+    rng_seed(&second, 5);
+    assert(game_rollout_batch(game, 37, &first) == game_rollout_batch(game, 37, &second),
+           "Batch rollout isn't deterministic for the same seed.");
+    assert(game->turns_taken == 1, "Batch rollout modified the starting position.");
+
+    rollout_scratch_free(scratch);
+    game_free(game);
+    scratch = NULL;
+    game = NULL;
+}
@@ -0,0 +1,12 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_PLAYOUT_BATCH_H
+#define TEST_PLAYOUT_BATCH_H
+
+void test_playout_batch_run(void);
+
+void test_game_rollout_batch(void);
+
+#endif //TEST_PLAYOUT_BATCH_H
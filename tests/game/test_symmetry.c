@@ -0,0 +1,165 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_symmetry.h"
+
+#include <string.h>
+
+#include "game.h"
+#include "symmetry.h"
+#include "utils/functions/std_utils.h"
+
+/**
+ * Check that two bitboards hold the same position.
+ */
+static bool bitboards_equal(const BitBoard* first, const BitBoard* second) {
+    return first->board_size == second->board_size &&
+           memcmp(first->player_one_board, second->player_one_board, sizeof(first->player_one_board)) == 0 &&
+           memcmp(first->player_two_board, second->player_two_board, sizeof(first->player_two_board)) == 0;
+}
+
+void test_symmetry_transform_tile(void) {
+    // the top-left corner of a 3x3 board under every symmetry
+    const uint16_t corner[NUM_SYMMETRIES] = {0, 2, 8, 6, 2, 6, 0, 8};
+    // the tile right of it
+    const uint16_t edge[NUM_SYMMETRIES] = {1, 5, 7, 3, 1, 7, 3, 5};
+    for (uint8_t symmetry = 0; symmetry < NUM_SYMMETRIES; symmetry++) {
+        assert(symmetry_transform_tile(3, 0, symmetry) == corner[symmetry], "Corner is transformed incorrectly by %d.",
+               symmetry);
+        assert(symmetry_transform_tile(3, 1, symmetry) == edge[symmetry], "Edge is transformed incorrectly by %d.",
+               symmetry);
+        assert(symmetry_transform_tile(3, 4, symmetry) == 4, "Center moved under symmetry %d.", symmetry);
+    }
+
+    // every symmetry is undone by its inverse and moves every tile somewhere else on the board
+    for (uint8_t symmetry = 0; symmetry < NUM_SYMMETRIES; symmetry++) {
+        for (uint16_t tile = 0; tile < 20 * 20; tile++) {
+            const uint16_t transformed = symmetry_transform_tile(20, tile, symmetry);
+            assert(transformed < 400, "Symmetry %d moved tile %d off the board.", symmetry, tile);
+            assert(symmetry_transform_tile(20, transformed, symmetry_inverse(symmetry)) == tile,
+                   "Inverse of symmetry %d doesn't restore tile %d.", symmetry, tile);
+        }
+    }
+}
+
+void test_bitboard_transform(void) {
+    Board* board = board_create(3);
+    board_from_string(board, "XO_______");
+    const BitBoard bitboard = bitboard_from_board(board);
+
+    // a quarter turn clockwise moves the top row into the right column
+    BitBoard rotated = bitboard_transform(&bitboard, SYMMETRY_ROTATE_90);
+    assert(bitboard_get(&rotated, 2, 0) == X && bitboard_get(&rotated, 2, 1) == O, "Rotated marks are incorrect.");
+    assert(bitboard_count_occupied(&rotated) == 2, "Rotation changed the number of marks.");
+
+    // four quarter turns and two flips are the identity
+    for (uint8_t i = 0; i < 3; i++) {
+        rotated = bitboard_transform(&rotated, SYMMETRY_ROTATE_90);
+    }
+    assert(bitboards_equal(&rotated, &bitboard), "Four quarter turns changed the position.");
+    const BitBoard flipped = bitboard_transform(&bitboard, SYMMETRY_TRANSPOSE);
+    const BitBoard flipped_back = bitboard_transform(&flipped, SYMMETRY_TRANSPOSE);
+    assert(bitboards_equal(&flipped_back, &bitboard), "Transposing twice changed the position.");
+
+    // transforms keep the patterns, on a board spanning several words as well
+    Game* game = game_create(12);
+    Rng rng;
+    rng_seed(&rng, 25);
+    uint16_t tiles[144];
+    for (uint8_t i = 0; i < 40; i++) {
+        const uint16_t num_tiles = board_get_legal_tiles(tiles, game->board);
+        const uint16_t tile = tiles[rng_below(&rng, num_tiles)];
+        game_move(game, tile % 12, tile / 12);
+    }
+    const BitBoard large = bitboard_from_board(game->board);
+    for (uint8_t symmetry = 0; symmetry < NUM_SYMMETRIES; symmetry++) {
+        const BitBoard transformed = bitboard_transform(&large, symmetry);
+        assert(bitboard_is_win(&transformed) == bitboard_is_win(&large), "Symmetry %d changed the win status.",
+               symmetry);
+        for (uint16_t tile = 0; tile < 144; tile++) {
+            const uint16_t target = symmetry_transform_tile(12, tile, symmetry);
+            assert(bitboard_get(&large, tile % 12, tile / 12) == bitboard_get(&transformed, target % 12, target / 12),
+                   "Symmetry %d moved tile %d incorrectly.", symmetry, tile);
+        }
+    }
+
+    board_free(board);
+    game_free(game);
+    board = NULL;
+    game = NULL;
+}
+
+void test_board_canonicalize(void) {
+    Board* board = board_create(4);
+    Board* canonical = board_create(4);
+    Board* other = board_create(4);
+    board_from_string(board, "_X______O____X__");
+    const BitBoard bitboard = bitboard_from_board(board);
+
+    // the returned symmetry transforms the position into the representative
+    const BoardSymmetry symmetry = board_canonicalize(board, canonical);
+    const BitBoard expected = bitboard_transform(&bitboard, symmetry);
+    const BitBoard result = bitboard_from_board(canonical);
+    assert(bitboards_equal(&result, &expected), "Canonical board doesn't match its symmetry.");
+
+    // all symmetric positions have the same representative
+    for (uint8_t i = 0; i < NUM_SYMMETRIES; i++) {
+        const BitBoard transformed = bitboard_transform(&bitboard, i);
+        BitBoard transformed_canonical;
+        bitboard_canonicalize(&transformed, &transformed_canonical);
+        assert(bitboards_equal(&transformed_canonical, &result), "Symmetry %d has a different representative.", i);
+    }
+
+    // a different position has a different representative
+    board_from_string(other, "XX______O_______");
+    board_canonicalize(other, other);
+    assert(!bitset_equals(other->player_one_board, canonical->player_one_board),
+           "Different positions have the same representative.");
+
+    board_free(board);
+    board_free(canonical);
+    board_free(other);
+    board = NULL;
+    canonical = NULL;
+    other = NULL;
+}
+
+/**
+ * Find the unique moves of a 3x3 position.
+ */
+static uint16_t unique_tiles_3x3(uint16_t* tiles, const char* repr) {
+    Board* board = board_create(3);
+    board_from_string(board, repr);
+    const uint16_t count = board_get_unique_legal_tiles(tiles, board);
+    board_free(board);
+    return count;
+}
+
+void test_board_get_unique_legal_tiles(void) {
+    uint16_t tiles[64];
+
+    // the empty 3x3 board has a corner, an edge and the center
+    assert(unique_tiles_3x3(tiles, "_________") == 3, "Empty 3x3 board has an incorrect number of classes.");
+    assert(tiles[0] == 0 && tiles[1] == 1 && tiles[2] == 4, "Empty 3x3 board has incorrect representatives.");
+
+    // with the center taken only the corner and the edge remain
+    assert(unique_tiles_3x3(tiles, "____X____") == 2, "3x3 with the center taken has incorrect classes.");
+
+    // a mark in the corner only keeps the main diagonal symmetry
+    const uint16_t expected[] = {1, 2, 4, 5, 8};
+    assert(unique_tiles_3x3(tiles, "X________") == 5, "3x3 with a corner taken has incorrect classes.");
+    for (uint8_t i = 0; i < 5; i++) {
+        assert(tiles[i] == expected[i], "3x3 with a corner taken has an incorrect representative %d.", i);
+    }
+
+    // without any symmetry every empty tile is a class of its own
+    assert(unique_tiles_3x3(tiles, "XO_______") == 7, "Asymmetric position merged some moves.");
+
+    // the empty 8x8 board has 10 classes (the tiles of one eighth, including the diagonal)
+    Board* large = board_create(8);
+    assert(board_get_unique_legal_tiles(tiles, large) == 10, "Empty 8x8 board has an incorrect number of classes.");
+
+    board_free(large);
+    large = NULL;
+}
@@ -0,0 +1,16 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_SYMMETRY_H
+#define TEST_SYMMETRY_H
+
+void test_symmetry_transform_tile(void);
+
+void test_bitboard_transform(void);
+
+void test_board_canonicalize(void);
+
+void test_board_get_unique_legal_tiles(void);
+
+#endif //TEST_SYMMETRY_H
@@ -0,0 +1,92 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_game_db.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "game_db.h"
+#include "solver.h"
+#include "utils/functions/std_utils.h"
+
+void test_game_db_index(void) {
+    Game* game = game_create(3);
+    assert(game_db_index(game) == 0, "Empty board doesn't have index 0.");
+
+    // X on tile 0 is digit 1 * 3^0, O on tile 2 is digit 2 * 3^2
+    game_move(game, 0, 0);
+    game_move(game, 2, 0);
+    assert(game_db_index(game) == 19, "Index of a 3x3 position is incorrect.");
+
+    // O on the last tile is the most significant digit
+    Game* corner = game_create(4);
+    game_move(corner, 0, 0);
+    game_move(corner, 3, 3);
+    assert(game_db_index(corner) == 1 + 2 * 14348907ULL, "Index of a 4x4 position is incorrect.");
+
+    game_free(game);
+    game_free(corner);
+    game = NULL;
+    corner = NULL;
+}
+
+void test_game_db_lookup(void) {
+    const char* path = "test_game_db_3x3.bin";
+    game_db_build(3, path);
+    GameDb* db = game_db_open(path);
+
+    assert(db->board_size == 3 && db->num_positions == 19683, "Database header is incorrect.");
+
+    Game* game = game_create(3);
+    assert(game_db_lookup(db, game) == DB_DRAW, "Empty 3x3 board isn't a draw.");
+
+    // X to move wins at 2,0
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+    assert(game_db_lookup(db, game) == DB_WIN, "Position with a winning move isn't a win.");
+
+    // after the winning move the game is lost for O
+    game_move(game, 2, 0);
+    assert(game_db_lookup(db, game) == DB_LOSS, "Won position isn't a loss for the player to move.");
+
+    // two X marks and no O can't happen in a game
+    Game* unreachable = game_create(3);
+    board_from_string(unreachable->board, "X___X____");
+    assert(game_db_lookup(db, unreachable) == DB_UNKNOWN, "Unreachable position has a value.");
+
+    // the database agrees with the solver along random games
+    TranspositionTable* table = transposition_table_create(12);
+    srand(7);
+    for (int i = 0; i < 20; i++) {
+        Game* played = game_create(3);
+
+        while (!game_is_tie(played)) {
+            const SolveResult solved = game_solve_with_table(played, 0, 0, table);
+            const GameDbValue expected = solved.value == 1 ? DB_WIN : solved.value == -1 ? DB_LOSS : DB_DRAW;
+            assert(game_db_lookup(db, played) == expected, "Database value differs from the solver.");
+
+            uint16_t tiles[9];
+            const uint16_t num_tiles = board_get_legal_tiles(tiles, played->board);
+            const uint16_t tile = tiles[rand() % num_tiles];
+            game_move(played, tile % 3, tile / 3);
+
+            if (game_is_win(played)) {
+                break;
+            }
+        }
+
+        game_free(played);
+    }
+
+    transposition_table_free(table);
+    game_free(game);
+    game_free(unreachable);
+    game_db_close(db);
+    remove(path);
+    table = NULL;
+    game = NULL;
+    unreachable = NULL;
+    db = NULL;
+}
@@ -0,0 +1,12 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_GAME_DB_H
+#define TEST_GAME_DB_H
+
+void test_game_db_index(void);
+
+void test_game_db_lookup(void);
+
+#endif //TEST_GAME_DB_H
@@ -0,0 +1,83 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_mcts.h"
+
+#include "mcts.h"
+#include "utils/functions/std_utils.h"
+
+void test_mcts_search(void) {
+    // X to move can win immediately by completing XOX at 2,0
+    Game* game = game_create(5);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+
+    Mcts* mcts = mcts_create(5, 100000, 1);
+    const MctsConfig config = {.max_iterations = 3000, .max_seconds = 0, .exploration = 1.41f};
+    const MctsResult result = mcts_search(mcts, game, &config);
+
+    assert(result.x == 2 && result.y == 0, "Search didn't find the winning move on a 5x5 board.");
+    assert(result.value > 0.9f, "Winning move wasn't evaluated as a win.");
+    assert(result.iterations == 3000, "Search didn't perform the requested number of iterations.");
+    assert(result.num_nodes > 1 && result.num_nodes <= 100000, "Search used an incorrect number of nodes.");
+    assert(game->turns_taken == 2, "Search modified the searched position.");
+
+    mcts_free(mcts);
+    game_free(game);
+    mcts = NULL;
+    game = NULL;
+}
+
+void test_mcts_budgets(void) {
+    Game* game = game_create(8);
+
+    // time budget only
+    Mcts* mcts = mcts_create(8, 50000, 2);
+    const MctsConfig time_config = {.max_iterations = 0, .max_seconds = 0.05, .exploration = 1.41f};
+    const MctsResult time_result = mcts_search(mcts, game, &time_config);
+    assert(time_result.iterations > 0, "Search with a time budget didn't perform any iterations.");
+
+    // a full pool stops the tree from growing, but the search continues
+    Mcts* small_mcts = mcts_create(8, 200, 3);
+    const MctsConfig iteration_config = {.max_iterations = 500, .max_seconds = 0, .exploration = 1.41f};
+    const MctsResult small_result = mcts_search(small_mcts, game, &iteration_config);
+    assert(small_result.iterations == 500, "Search with a full node pool stopped early.");
+    assert(small_result.num_nodes <= 200, "Search used more nodes than the pool capacity.");
+
+    mcts_free(mcts);
+    mcts_free(small_mcts);
+    game_free(game);
+    mcts = NULL;
+    small_mcts = NULL;
+    game = NULL;
+}
+
+void test_parallel_mcts_search(void) {
+    // same position as in test_mcts_search, X wins at 2,0
+    Game* game = game_create(5);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+
+    ParallelMcts* mcts = parallel_mcts_create(5, 100000, 4, 1);
+    const MctsConfig config = {.max_iterations = 4000, .max_seconds = 0, .exploration = 1.41f};
+    const MctsResult result = parallel_mcts_search(mcts, game, &config);
+
+    assert(result.x == 2 && result.y == 0, "Parallel search didn't find the winning move on a 5x5 board.");
+    assert(result.value > 0.9f, "Winning move wasn't evaluated as a win by the parallel search.");
+    assert(result.iterations == 4000, "Parallel search didn't perform the requested number of iterations.");
+    assert(result.num_nodes > 1 && result.num_nodes <= 100000, "Parallel search used an incorrect number of nodes.");
+
+    // the tree is reset between searches, and a full pool doesn't stop the threads
+    ParallelMcts* small_mcts = parallel_mcts_create(5, 100, 4, 2);
+    const MctsResult small_result = parallel_mcts_search(small_mcts, game, &config);
+    assert(small_result.iterations == 4000, "Parallel search with a full node pool stopped early.");
+    assert(small_result.num_nodes <= 100, "Parallel search used more nodes than the pool capacity.");
+
+    parallel_mcts_free(mcts);
+    parallel_mcts_free(small_mcts);
+    game_free(game);
+    mcts = NULL;
+    small_mcts = NULL;
+    game = NULL;
+}
@@ -0,0 +1,14 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_MCTS_H
+#define TEST_MCTS_H
+
+void test_mcts_search(void);
+
+void test_mcts_budgets(void);
+
+void test_parallel_mcts_search(void);
+
+#endif //TEST_MCTS_H
@@ -0,0 +1,96 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "test_solver.h"
+
+#include <string.h>
+
+#include "solver.h"
+#include "utils/functions/std_utils.h"
+
+void test_game_solve(void) {
+    // X to move can win immediately by completing XOX at 2,0
+    Game* game = game_create(5);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+
+    const SolveResult win = game_solve(game, 0, 0);
+    assert(win.x == 2 && win.y == 0, "Solver didn't find the winning move on a 5x5 board.");
+    assert(win.solved && win.value == 1, "Immediate win wasn't proven.");
+    assert(win.plies_to_end == 1, "Immediate win has an incorrect distance.");
+    assert(game->turns_taken == 2 && game->current_player == X, "Solver didn't restore the searched position.");
+    assert(game->hash == game_compute_hash(game), "Solver didn't restore the position hash.");
+    assert(game->last_x == 1 && game->last_y == 0, "Solver didn't restore the last move.");
+
+    // the full 3x3 game is a draw
+    Game* empty = game_create(3);
+    const SolveResult draw = game_solve(empty, 0, 0);
+    assert(draw.solved && draw.value == 0, "3x3 board wasn't solved as a draw.");
+    assert(draw.depth == 9, "3x3 board wasn't searched to the end of the game.");
+
+    char repr[10];
+    board_to_string(empty->board, repr);
+    assert(strcmp(repr, "_________") == 0, "Solver didn't restore the searched board.");
+
+    // on 4x4 the first player loses, the game lasts 12 plies with best play
+    Game* larger = game_create(4);
+    const SolveResult loss = game_solve(larger, 0, 0);
+    assert(loss.solved && loss.value == -1, "4x4 board wasn't solved as a loss for the first player.");
+    assert(loss.plies_to_end == 12, "4x4 loss has an incorrect distance.");
+
+    game_free(game);
+    game_free(empty);
+    game_free(larger);
+    game = NULL;
+    empty = NULL;
+    larger = NULL;
+}
+
+void test_game_solve_budgets(void) {
+    Game* game = game_create(8);
+
+    // too shallow to prove anything on an empty board
+    const SolveResult shallow = game_solve(game, 2, 0);
+    assert(!shallow.solved && shallow.value == 0, "Depth-limited search claimed a proven result.");
+    assert(shallow.depth == 2, "Depth-limited search didn't complete its iterations.");
+    assert(shallow.x < 8 && shallow.y < 8, "Depth-limited search returned an invalid move.");
+
+    // a time budget stops the deepening, but at least one iteration completes
+    TranspositionTable* table = transposition_table_create(16);
+    const SolveResult timed = game_solve_with_table(game, 0, 0.05, table);
+    assert(timed.depth >= 1 && timed.nodes > 0, "Search with a time budget didn't complete an iteration.");
+    assert(game->turns_taken == 0, "Search with a time budget didn't restore the searched position.");
+
+    transposition_table_free(table);
+    game_free(game);
+    table = NULL;
+    game = NULL;
+}
+
+void test_game_solve_table_reuse(void) {
+    // entries of the 3x3 solve must not be used on 4x4, even for positions with the same marked tile indices
+    TranspositionTable* table = transposition_table_create(16);
+    Game* small = game_create(3);
+    Game* large = game_create(4);
+
+    const SolveResult draw = game_solve_with_table(small, 0, 0, table);
+    assert(draw.solved && draw.value == 0, "3x3 board wasn't solved as a draw with a reused table.");
+
+    const SolveResult loss = game_solve_with_table(large, 0, 0, table);
+    assert(loss.solved && loss.value == -1, "4x4 board used results of a 3x3 board from a reused table.");
+    assert(loss.plies_to_end == 12, "4x4 loss has an incorrect distance with a reused table.");
+
+    // and back
+    game_move(small, 0, 0);
+    game_move(large, 0, 0);
+    const SolveResult small_again = game_solve_with_table(small, 0, 0, table);
+    assert(small_again.solved && small_again.value == 0, "3x3 board used results of a 4x4 board from a reused table.");
+
+    transposition_table_free(table);
+    game_free(small);
+    game_free(large);
+    table = NULL;
+    small = NULL;
+    large = NULL;
+}
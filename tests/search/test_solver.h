@@ -0,0 +1,14 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_SOLVER_H
+#define TEST_SOLVER_H
+
+void test_game_solve(void);
+
+void test_game_solve_budgets(void);
+
+void test_game_solve_table_reuse(void);
+
+#endif //TEST_SOLVER_H
@@ -4,40 +4,124 @@
 
 #include <stdio.h>
 
+#include "utils/data_structures/test_arena.h"
 #include "utils/data_structures/test_bitset.h"
+#include "utils/functions/test_rng.h"
+#include "utils/functions/test_stats.h"
 #include "game/test_board.h"
+#include "game/test_bitboard.h"
 #include "game/test_game.h"
+#include "game/test_game_encoding.h"
+#include "game/test_game_record.h"
+#include "game/test_playout_batch.h"
+#include "game/test_symmetry.h"
+#include "search/test_game_db.h"
+#include "search/test_mcts.h"
+#include "search/test_solver.h"
 
 int main(void) {
     // test all bitset methods
     test_bitset_init();
     test_bitset_clone();
+    test_bitset_copy_into();
     test_bitset_set();
     test_bitset_clear();
     test_bitset_flip();
     test_bitset_get();
     test_bitset_to_string();
+    test_bitset_unchecked();
+    test_bitset_bulk_operations();
+    test_bitset_popcount();
+    test_bitset_find_set();
+    test_bitset_equals();
+
+    // test all generator methods
+    test_rng_seed();
+    test_rng_below();
+    test_rng_split();
+
+    // test the statistics
+    test_stats_counters();
+    test_stats_threads();
+
+    // test all arena methods
+    test_arena_alloc();
+    test_arena_reset();
 
     // test all board methods
     test_board_init();
     test_board_clone();
+    test_board_copy_into();
     test_board_get();
+    test_board_get_index();
     test_board_set();
+    test_board_unchecked();
     test_board_coordinates_in_bounds();
     test_board_get_legal_moves();
+    test_board_get_legal_tiles();
     test_board_shuffle_moves();
+    test_board_shuffle_moves_rng();
     test_board_to_string();
     test_board_from_string();
 
+    // test all bitboard methods
+    test_bitboard_init();
+    test_bitboard_from_board();
+    test_bitboard_to_board();
+    test_bitboard_get();
+    test_bitboard_set();
+    test_bitboard_occupancy();
+    test_bitboard_find_patterns();
+    test_bitboard_is_win();
+
+    // test the board symmetries
+    test_symmetry_transform_tile();
+    test_bitboard_transform();
+    test_board_canonicalize();
+    test_board_get_unique_legal_tiles();
+
     // test all game methods
     test_game_clone();
+    test_game_copy_into();
+    test_game_create_in();
+    test_game_clone_in();
     test_game_move();
     test_game_un_move();
+    test_game_move_unchecked();
+    test_game_history();
+    test_game_hash();
     test_game_is_tie();
     test_game_is_win();
+    test_game_is_win_full();
     test_game_full_suite();
     test_game_random_play();
+    test_game_random_play_rng();
     test_game_rollout();
+    test_game_rollout_with_scratch();
+    test_game_rollout_rng();
+    test_game_rollout_parallel();
+    test_playout_batch_run();
+    test_game_rollout_batch();
+
+    // test the binary position format
+    test_game_encode();
+    test_game_encode_batch();
+    test_game_encoding_verify();
+
+    // test the game log
+    test_game_record_write_read();
+    test_game_record_replay();
+    test_game_record_truncated();
+
+    // test the search
+    test_mcts_search();
+    test_mcts_budgets();
+    test_parallel_mcts_search();
+    test_game_solve();
+    test_game_solve_budgets();
+    test_game_solve_table_reuse();
+    test_game_db_index();
+    test_game_db_lookup();
 
     printf("All tests passed.\n");
 
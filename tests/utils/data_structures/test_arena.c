@@ -0,0 +1,46 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/functions/std_utils.h"
+#include "arena.h"
+
+void test_arena_alloc(void) {
+    OxoxArena* arena = oxox_arena_create(64);
+
+    // allocations are aligned and don't overlap
+    uint8_t* first = oxox_arena_alloc(arena, 3);
+    uint8_t* second = oxox_arena_alloc(arena, 5);
+    assert((uintptr_t)first % alignof(max_align_t) == 0, "First arena allocation isn't aligned.");
+    assert((uintptr_t)second % alignof(max_align_t) == 0, "Second arena allocation isn't aligned.");
+    assert(second >= first + 3, "Arena allocations overlap.");
+
+    // allocations larger than a chunk get a chunk of their own
+    uint8_t* large = oxox_arena_alloc(arena, 1000);
+    memset(large, 1, 1000);
+    assert(large[999] == 1, "Large arena allocation isn't usable.");
+
+    oxox_arena_free(arena);
+    arena = NULL;
+}
+
+void test_arena_reset(void) {
+    OxoxArena* arena = oxox_arena_create(128);
+
+    uint8_t* first = oxox_arena_alloc(arena, 16);
+    for (int i = 0; i < 20; i++) {
+        oxox_arena_alloc(arena, 32);
+    }
+
+    // after a reset, the memory is handed out again from the beginning
+    oxox_arena_reset(arena);
+    uint8_t* reused = oxox_arena_alloc(arena, 16);
+    assert(first == reused, "Arena didn't reuse its memory after a reset.");
+
+    oxox_arena_free(arena);
+    arena = NULL;
+}
@@ -0,0 +1,12 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_ARENA_H
+#define TEST_ARENA_H
+
+void test_arena_alloc(void);
+
+void test_arena_reset(void);
+
+#endif //TEST_ARENA_H
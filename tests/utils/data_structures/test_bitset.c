@@ -7,6 +7,7 @@
 
 #include "utils/functions/std_utils.h"
 #include "bitset.h"
+#include "unchecked.h"
 
 void test_bitset_init(void) {
     // 1-bit bitset
@@ -23,16 +24,22 @@ void test_bitset_init(void) {
 
     // 22-bit bitset
     BitSet* bitset22 = bitset_create(22);
-    assert(bitset22->bits[0] == 0, "First byte of the 22-bit bitset didn't initialize correctly.");
-    assert(bitset22->bits[1] == 0, "Second byte of the 22-bit bitset didn't initialize correctly.");
-    assert(bitset22->bits[2] == 0, "Third byte of the 22-bit bitset didn't initialize correctly.");
+    assert(bitset22->bits[0] == 0, "Bitset of length 22 didn't initialize correctly.");
     bitset_free(bitset22);
     bitset22 = NULL;
+
+    // 130-bit bitset (3 words), the data has to be aligned
+    BitSet* bitset130 = bitset_create(130);
+    assert(bitset130->bits[0] == 0 && bitset130->bits[1] == 0 && bitset130->bits[2] == 0,
+           "Bitset of length 130 didn't initialize correctly.");
+    assert((uintptr_t)bitset130->bits % BITSET_ALIGNMENT == 0, "Bitset data isn't aligned.");
+    bitset_free(bitset130);
+    bitset130 = NULL;
 }
 
 void test_bitset_clone(void) {
     // 8-bit bitset
-    uint8_t buffer8[] = {0b00101011};
+    uint64_t buffer8[] = {0b00101011};
     const BitSet bitset8 = {buffer8, 8};
     BitSet* bitset8_clone = bitset_clone(&bitset8);
 
@@ -43,20 +50,40 @@ void test_bitset_clone(void) {
     bitset8_clone = NULL;
 
     // 22-bit bitset
-    uint8_t buffer22[] = {0b01101000, 0b01101111, 0b01011010};
+    uint64_t buffer22[] = {0b010110100110111101101000};
     const BitSet bitset22 = {buffer22, 22};
     BitSet* bitset22_clone = bitset_clone(&bitset22);
 
     assert(bitset22.size == bitset22_clone->size, "Cloned 22-bit bitset doesn't have the original's size.");
-    assert(bitset22.bits[0] == bitset22_clone->bits[0],
-           "First byte of the 22-bit cloned bitset doesn't match original.");
-    assert(bitset22.bits[1] == bitset22_clone->bits[1],
-           "Second byte of the 22-bit cloned bitset doesn't match original.");
-    assert(bitset22.bits[2] == bitset22_clone->bits[2],
-           "Third byte of the 22-bit cloned bitset doesn't match original.");
+    assert(bitset22.bits[0] == bitset22_clone->bits[0], "Cloned 22-bit bitset doesn't have the same data.");
 
     bitset_free(bitset22_clone);
     bitset22_clone = NULL;
+
+    // 130-bit bitset
+    uint64_t buffer130[] = {0x0123456789ABCDEF, UINT64_MAX, 0b11};
+    const BitSet bitset130 = {buffer130, 130};
+    BitSet* bitset130_clone = bitset_clone(&bitset130);
+
+    assert(memcmp(bitset130.bits, bitset130_clone->bits, sizeof(buffer130)) == 0,
+           "Cloned 130-bit bitset doesn't have the same data.");
+
+    bitset_free(bitset130_clone);
+    bitset130_clone = NULL;
+}
+
+void test_bitset_copy_into(void) {
+    // 22-bit bitset
+    uint64_t buffer22[] = {0b010110100110111101101000};
+    const BitSet bitset22 = {buffer22, 22};
+    BitSet* target22 = bitset_create(22);
+    bitset_set(target22, 0);
+    bitset_copy_into(target22, &bitset22);
+
+    assert(target22->bits[0] == bitset22.bits[0], "22-bit bitset wasn't copied correctly.");
+
+    bitset_free(target22);
+    target22 = NULL;
 }
 
 void test_bitset_set(void) {
@@ -82,18 +109,30 @@ void test_bitset_set(void) {
     BitSet* bitset22 = bitset_create(22);
 
     bitset_set(bitset22, 11);
-    assert(bitset22->bits[1] == 0b00001000, "12th bit of the 22-bit bitset wasn't set correctly.");
+    assert(bitset22->bits[0] == 0b00001000 << 8, "12th bit of the 22-bit bitset wasn't set correctly.");
 
     bitset_set(bitset22, 16);
-    assert(bitset22->bits[2] == 0b00000001, "17th bit of the 22-bit bitset wasn't set correctly.");
+    assert(bitset22->bits[0] == (0b00001000 << 8 | 0b00000001 << 16),
+           "17th bit of the 22-bit bitset wasn't set correctly.");
 
     bitset_free(bitset22);
     bitset22 = NULL;
+
+    // 130-bit bitset, the bits in the following words
+    BitSet* bitset130 = bitset_create(130);
+
+    bitset_set(bitset130, 64);
+    bitset_set(bitset130, 129);
+    assert(bitset130->bits[0] == 0 && bitset130->bits[1] == 1 && bitset130->bits[2] == 0b10,
+           "Bits of the 130-bit bitset weren't set correctly.");
+
+    bitset_free(bitset130);
+    bitset130 = NULL;
 }
 
 void test_bitset_clear(void) {
     // 8-bit bitset
-    uint8_t buffer8[] = {0b01000101};
+    uint64_t buffer8[] = {0b01000101};
     const BitSet bitset8 = {buffer8, 8};
 
     bitset_clear(&bitset8, 0);
@@ -107,19 +146,19 @@ void test_bitset_clear(void) {
            "A change occurred after clearing an already cleared bit of the 8-bit bitset.");
 
     // 22-bit bitset
-    uint8_t buffer22[] = {0, 0b00000010, 0b00000101};
+    uint64_t buffer22[] = {0b00000101 << 16 | 0b00000010 << 8};
     const BitSet bitset22 = {buffer22, 22};
 
     bitset_clear(&bitset22, 9);
-    assert(bitset22.bits[1] == 0, "10th bit of the 22-bit bitset wasn't cleared correctly.");
+    assert(bitset22.bits[0] == 0b00000101 << 16, "10th bit of the 22-bit bitset wasn't cleared correctly.");
 
     bitset_clear(&bitset22, 18);
-    assert(bitset22.bits[2] == 0b00000001, "19th bit of the 22-bit bitset wasn't cleared correctly.");
+    assert(bitset22.bits[0] == 0b00000001 << 16, "19th bit of the 22-bit bitset wasn't cleared correctly.");
 }
 
 void test_bitset_flip(void) {
     // 8-bit bitset
-    uint8_t buffer8[] = {0b00101011};
+    uint64_t buffer8[] = {0b00101011};
     const BitSet bitset8 = {buffer8, 8};
 
     bitset_flip(&bitset8, 0);
@@ -132,26 +171,26 @@ void test_bitset_flip(void) {
     assert(bitset8.bits[0] == 0b00101010, "Couldn't flip bit back to original state in the 8-bit bitset.");
 
     // 22-bit bitset
-    uint8_t buffer22[] = {0b00000101, 0b00100100, 0b00001100};
+    uint64_t buffer22[] = {0b00001100 << 16 | 0b00100100 << 8 | 0b00000101};
     const BitSet bitset22 = {buffer22, 22};
 
     bitset_flip(&bitset22, 13);
-    assert(bitset22.bits[1] == 0b00000100, "14th bit of the 22-bit bitset wasn't flipped correctly.");
+    assert((bitset22.bits[0] >> 8 & 0xFF) == 0b00000100, "14th bit of the 22-bit bitset wasn't flipped correctly.");
 
     bitset_flip(&bitset22, 19);
-    assert(bitset22.bits[2] == 0b00000100, "20th bit of the 22-bit bitset wasn't flipped correctly.");
+    assert((bitset22.bits[0] >> 16 & 0xFF) == 0b00000100, "20th bit of the 22-bit bitset wasn't flipped correctly.");
 }
 
 void test_bitset_get(void) {
     // 8-bit bitset
-    uint8_t buffer8[] = {0b01101100};
+    uint64_t buffer8[] = {0b01101100};
     const BitSet bitset8 = {buffer8, 8};
 
     assert(!bitset_get(&bitset8, 1), "Incorrect value returned at index 1 of an 8-bit bitset.");
     assert(bitset_get(&bitset8, 2), "Incorrect value returned at index 2 of an 8-bit bitset.");
 
     // 22-bit bitset
-    uint8_t buffer22[] = {0, 0b1110001, 0b0001110};
+    uint64_t buffer22[] = {0b0001110 << 16 | 0b1110001 << 8};
     const BitSet bitset22 = {buffer22, 22};
 
     assert(!bitset_get(&bitset22, 9), "Incorrect value returned at index 9 of a 22-bit bitset.");
@@ -160,21 +199,21 @@ void test_bitset_get(void) {
 
 void test_bitset_to_string(void) {
     // 1-bit bitset
-    uint8_t buffer1[] = {0b00000001};
+    uint64_t buffer1[] = {0b00000001};
     const BitSet bitset1 = {buffer1, 1};
     char repr1[2];
     bitset_to_string(&bitset1, repr1);
     assert(strcmp(repr1, "1") == 0, "String representation of a 1-bit bitset is incorrect.");
 
     // 8-bit bitset
-    uint8_t buffer8[] = {0b10100100};
+    uint64_t buffer8[] = {0b10100100};
     const BitSet bitset8 = {buffer8, 8};
     char repr8[9];
     bitset_to_string(&bitset8, repr8);
     assert(strcmp(repr8, "00100101") == 0, "String representation of an 8-bit bitset is incorrect.");
 
     // 22-bit bitset
-    uint8_t buffer22[] = {0b10100100, 0b10111000, 0b00111111};
+    uint64_t buffer22[] = {0b00111111 << 16 | 0b10111000 << 8 | 0b10100100};
     // note: the last one's significant digits are only the last 6 (because the length is 22 and not 24)
     const BitSet bitset22 = {buffer22, 22};
     char repr22[23];
@@ -203,9 +242,146 @@ void test_bitset_from_string(void) {
     BitSet* bitset22 = bitset_create(22);
     const char* repr22 = "0110110011101000101110";
     bitset_from_string(bitset22, repr22);
-    assert(bitset22->bits[0] == 0b00110110, "First byte of the 22-bit bitset didn't load correctly from the string.");
-    assert(bitset22->bits[1] == 0b00010111, "Second byte of the 22-bit bitset didn't load correctly from the string.");
-    assert(bitset22->bits[2] == 0b00011101, "Third byte of the 22-bit bitset didn't load correctly from the string.");
+    assert(bitset22->bits[0] == (0b00011101 << 16 | 0b00010111 << 8 | 0b00110110),
+           "The 22-bit bitset didn't load correctly from the string.");
     bitset_free(bitset22);
     bitset22 = NULL;
 }
+
+void test_bitset_unchecked(void) {
+    BitSet* bitset = bitset_create(20);
+
+    bitset_set_unchecked(bitset, 0);
+    bitset_set_unchecked(bitset, 9);
+    bitset_set_unchecked(bitset, 19);
+    assert(bitset->bits[0] == (0b00001000 << 16 | 0b00000010 << 8 | 0b00000001),
+           "Unchecked set changed the wrong bits.");
+    assert(bitset_get_unchecked(bitset, 9) && bitset_get_unchecked(bitset, 19), "Unchecked get missed a set bit.");
+    assert(!bitset_get_unchecked(bitset, 8), "Unchecked get returned a bit that isn't set.");
+
+    bitset_clear_unchecked(bitset, 9);
+    assert((bitset->bits[0] >> 8 & 0xFF) == 0, "Unchecked clear didn't clear the bit.");
+    assert(bitset_get_unchecked(bitset, 0) && bitset_get_unchecked(bitset, 19),
+           "Unchecked clear changed other bits.");
+
+    bitset_free(bitset);
+}
+
+void test_bitset_bulk_operations(void) {
+    // small sets are combined inline, large ones (here 5 words) by the SIMD kernel with a scalar tail
+    const size_t sizes[] = {22, 300};
+
+    for (int s = 0; s < 2; s++) {
+        const size_t size = sizes[s];
+        BitSet* left = bitset_create(size);
+        BitSet* right = bitset_create(size);
+        BitSet* target = bitset_create(size);
+
+        for (size_t i = 0; i < size; i++) {
+            if (i % 3 == 0) {
+                bitset_set(left, i);
+            }
+            if (i % 5 == 0) {
+                bitset_set(right, i);
+            }
+        }
+
+        bool and_correct = true;
+        bool or_correct = true;
+        bool xor_correct = true;
+        bool andnot_correct = true;
+        bool not_correct = true;
+
+        bitset_and(target, left, right);
+        for (size_t i = 0; i < size; i++) {
+            and_correct &= bitset_get(target, i) == (i % 3 == 0 && i % 5 == 0);
+        }
+        bitset_or(target, left, right);
+        for (size_t i = 0; i < size; i++) {
+            or_correct &= bitset_get(target, i) == (i % 3 == 0 || i % 5 == 0);
+        }
+        bitset_xor(target, left, right);
+        for (size_t i = 0; i < size; i++) {
+            xor_correct &= bitset_get(target, i) == ((i % 3 == 0) != (i % 5 == 0));
+        }
+        bitset_andnot(target, left, right);
+        for (size_t i = 0; i < size; i++) {
+            andnot_correct &= bitset_get(target, i) == (i % 3 == 0 && i % 5 != 0);
+        }
+        bitset_not(target, left);
+        for (size_t i = 0; i < size; i++) {
+            not_correct &= bitset_get(target, i) == (i % 3 != 0);
+        }
+
+        assert(and_correct, "AND of %zu-bit bitsets is incorrect.", size);
+        assert(or_correct, "OR of %zu-bit bitsets is incorrect.", size);
+        assert(xor_correct, "XOR of %zu-bit bitsets is incorrect.", size);
+        assert(andnot_correct, "AND NOT of %zu-bit bitsets is incorrect.", size);
+        assert(not_correct, "NOT of a %zu-bit bitset is incorrect.", size);
+        assert(target->bits[bitset_num_words(size) - 1] >> size % 64 == 0,
+               "NOT of a %zu-bit bitset set the bits past the size.", size);
+
+        // the target can be one of the operands
+        bitset_and(left, left, right);
+        assert(bitset_popcount(left) == (size - 1) / 15 + 1, "In-place AND of %zu-bit bitsets is incorrect.", size);
+
+        bitset_free(left);
+        bitset_free(right);
+        bitset_free(target);
+    }
+}
+
+void test_bitset_popcount(void) {
+    uint64_t buffer22[] = {0b10100100};
+    const BitSet bitset22 = {buffer22, 22};
+    assert(bitset_popcount(&bitset22) == 3, "Popcount of the 22-bit bitset is incorrect.");
+
+    uint64_t buffer300[] = {UINT64_MAX, 0, 0b101, UINT64_MAX, 0b111};
+    const BitSet bitset300 = {buffer300, 300};
+    assert(bitset_popcount(&bitset300) == 133, "Popcount of the 300-bit bitset is incorrect.");
+}
+
+void test_bitset_find_set(void) {
+    uint64_t empty_buffer[] = {0, 0, 0};
+    const BitSet empty = {empty_buffer, 150};
+    assert(bitset_find_first_set(&empty) == BITSET_NOT_FOUND, "Found a set bit in an empty bitset.");
+
+    // bits 5, 63, 64 and 149
+    uint64_t buffer[] = {(uint64_t)1 << 63 | 1 << 5, 1, (uint64_t)1 << 21};
+    const BitSet bitset = {buffer, 150};
+    const size_t expected[] = {5, 63, 64, 149};
+
+    size_t found = 0;
+    bool order_correct = true;
+    for (size_t i = bitset_find_first_set(&bitset); i != BITSET_NOT_FOUND; i = bitset_find_next_set(&bitset, i)) {
+        order_correct &= found < 4 && i == expected[found];
+        found++;
+    }
+
+    assert(found == 4 && order_correct, "Iteration over the set bits found %zu bits (expected 5, 63, 64, 149).", found);
+    assert(bitset_find_next_set(&bitset, 6) == 63, "Search after an unset bit didn't find the next set bit.");
+    assert(bitset_find_next_set(&bitset, 149) == BITSET_NOT_FOUND, "Found a set bit after the last bit.");
+}
+
+void test_bitset_equals(void) {
+    BitSet* first = bitset_create(200);
+    BitSet* second = bitset_create(200);
+    BitSet* other_size = bitset_create(199);
+
+    bitset_set(first, 3);
+    bitset_set(first, 150);
+    bitset_set(second, 3);
+
+    assert(!bitset_equals(first, second), "Bitsets with different bits are equal.");
+    bitset_set(second, 150);
+    assert(bitset_equals(first, second), "Bitsets with the same bits aren't equal.");
+    assert(bitset_hash(first) == bitset_hash(second), "Equal bitsets have different hashes.");
+    assert(!bitset_equals(first, other_size), "Bitsets of different sizes are equal.");
+
+    bitset_flip(second, 199);
+    assert(bitset_hash(first) != bitset_hash(second), "Changing the last bit didn't change the hash.");
+
+    bitset_free(first);
+    bitset_free(second);
+    bitset_free(other_size);
+}
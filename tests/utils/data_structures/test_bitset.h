@@ -9,6 +9,8 @@ void test_bitset_init(void);
 
 void test_bitset_clone(void);
 
+void test_bitset_copy_into(void);
+
 void test_bitset_set(void);
 
 void test_bitset_clear(void);
@@ -19,6 +21,16 @@ void test_bitset_get(void);
 
 void test_bitset_to_string(void);
 
+void test_bitset_unchecked(void);
+
+void test_bitset_bulk_operations(void);
+
+void test_bitset_popcount(void);
+
+void test_bitset_find_set(void);
+
+void test_bitset_equals(void);
+
 void test_bitset_from_string(void);
 
 #endif //TEST_BITSET_H
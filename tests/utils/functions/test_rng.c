@@ -0,0 +1,61 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "utils/functions/std_utils.h"
+#include "rng.h"
+
+void test_rng_seed(void) {
+    Rng rng;
+    Rng same_rng;
+    Rng other_rng;
+    rng_seed(&rng, 123);
+    rng_seed(&same_rng, 123);
+    rng_seed(&other_rng, 124);
+
+    bool all_equal = true;
+    bool any_different = false;
+    for (int i = 0; i < 100; i++) {
+        const uint64_t value = rng_next(&rng);
+        all_equal &= value == rng_next(&same_rng);
+        any_different |= value != rng_next(&other_rng);
+    }
+
+    assert(all_equal, "Generators with the same seed produced different sequences.");
+    assert(any_different, "Generators with different seeds produced the same sequence.");
+}
+
+void test_rng_below(void) {
+    Rng rng;
+    rng_seed(&rng, 1);
+
+    // every value is in range and, over enough samples, every value of a small range shows up
+    unsigned int counts[7] = {0};
+    bool in_range = true;
+    for (int i = 0; i < 7000; i++) {
+        const uint32_t value = rng_below(&rng, 7);
+        in_range &= value < 7;
+        if (value < 7) {
+            counts[value]++;
+        }
+    }
+
+    assert(in_range, "Generator produced a value outside of the range [0, 7).");
+    for (int i = 0; i < 7; i++) {
+        assert(counts[i] > 800 && counts[i] < 1200, "Value %d appeared %u times out of 7000.", i, counts[i]);
+    }
+
+    assert(rng_below(&rng, 1) == 0, "Generator produced a value outside of the range [0, 1).");
+}
+
+void test_rng_split(void) {
+    Rng rng;
+    rng_seed(&rng, 99);
+    const Rng original = rng;
+
+    // the split stream continues the original sequence, the parent jumps ahead
+    Rng split = rng_split(&rng);
+    Rng continued = original;
+    assert(rng_next(&split) == rng_next(&continued), "Split stream doesn't continue the original sequence.");
+    assert(rng_next(&rng) != rng_next(&split), "Split streams produced the same value.");
+}
@@ -0,0 +1,14 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_RNG_H
+#define TEST_RNG_H
+
+void test_rng_seed(void);
+
+void test_rng_below(void);
+
+void test_rng_split(void);
+
+#endif //TEST_RNG_H
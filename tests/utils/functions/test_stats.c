@@ -0,0 +1,84 @@
+//
+// Created on 16.10.2026.
+//
+
+#include "utils/functions/std_utils.h"
+#include "game.h"
+#include "stats.h"
+
+/**
+ * Check that all the counters of a snapshot are 0.
+ */
+static bool stats_all_zero(const OxoxStats* stats) {
+    return stats->bitset_allocations == 0 && stats->board_allocations == 0 && stats->game_allocations == 0 &&
+           stats->win_checks == 0 && stats->board_gets == 0 && stats->moves == 0 && stats->playouts == 0 &&
+           stats->playout_moves == 0 && stats->playout_wins == 0 && stats->playout_draws == 0 &&
+           stats->playout_losses == 0;
+}
+
+void test_stats_counters(void) {
+    oxox_stats_reset();
+
+    Game* game = game_create(3);
+    game_move(game, 0, 0);
+    game_move(game, 1, 0);
+    game_is_win(game);
+    board_get(game->board, 0, 0);
+
+    OxoxStats stats = oxox_stats_snapshot();
+#ifdef OXOX_STATS
+    assert(stats.game_allocations == 1, "Expected 1 game allocation, got %llu.",
+           (unsigned long long)stats.game_allocations);
+    assert(stats.board_allocations == 1, "Expected 1 board allocation, got %llu.",
+           (unsigned long long)stats.board_allocations);
+    assert(stats.bitset_allocations == 2, "Expected 2 bitset allocations, got %llu.",
+           (unsigned long long)stats.bitset_allocations);
+    assert(stats.moves == 2, "Expected 2 moves, got %llu.", (unsigned long long)stats.moves);
+    assert(stats.win_checks >= 1, "Win check wasn't counted.");
+    assert(stats.board_gets >= 1, "Board get wasn't counted.");
+    assert(stats.playouts == 0, "Expected no playouts, got %llu.", (unsigned long long)stats.playouts);
+
+    const uint16_t turns_before = game->turns_taken;
+    game_random_play(game);
+    stats = oxox_stats_snapshot();
+    assert(stats.playouts == 1, "Expected 1 playout, got %llu.", (unsigned long long)stats.playouts);
+    assert(stats.playout_wins + stats.playout_draws + stats.playout_losses == 1,
+           "Playout results don't add up to the number of playouts.");
+    assert(stats.playout_moves == (uint64_t)(game->turns_taken - turns_before),
+           "Expected %d playout moves, got %llu.", game->turns_taken - turns_before,
+           (unsigned long long)stats.playout_moves);
+
+    oxox_stats_reset();
+    stats = oxox_stats_snapshot();
+#endif
+    assert(stats_all_zero(&stats), "Counters aren't 0 after a reset (or with the statistics disabled).");
+
+    game_free(game);
+}
+
+void test_stats_threads(void) {
+    oxox_stats_reset();
+
+    // the worker threads exit before the call returns, their counters must still be included
+    const unsigned int num_iterations = 100;
+    Game* small = game_create(4);
+    Game* large = game_create(9);
+    game_rollout_parallel(small, num_iterations, 4, 1);
+    game_rollout_parallel(large, num_iterations, 4, 1);
+
+    const OxoxStats stats = oxox_stats_snapshot();
+#ifdef OXOX_STATS
+    assert(stats.playouts == 2 * num_iterations, "Expected %u playouts, got %llu.", 2 * num_iterations,
+           (unsigned long long)stats.playouts);
+    assert(stats.playout_wins + stats.playout_draws + stats.playout_losses == stats.playouts,
+           "Playout results don't add up to the number of playouts.");
+    assert(stats.playout_moves >= 3 * stats.playouts, "Playouts are too short (%llu moves).",
+           (unsigned long long)stats.playout_moves);
+#else
+    assert(stats_all_zero(&stats), "Counters aren't 0 with the statistics disabled.");
+#endif
+
+    game_free(small);
+    game_free(large);
+    oxox_stats_reset();
+}
@@ -0,0 +1,12 @@
+//
+// Created on 16.10.2026.
+//
+
+#ifndef TEST_STATS_H
+#define TEST_STATS_H
+
+void test_stats_counters(void);
+
+void test_stats_threads(void);
+
+#endif //TEST_STATS_H
@@ -0,0 +1,38 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "game_db.h"
+#include "utils/functions/std_utils.h"
+
+// usage: oxox_game_db <board size> <output file>
+int main(const int argc, char** argv) {
+    if (argc != 3) {
+        println("Usage: %s <board size (1 to %d)> <output file>", argv[0], GAME_DB_MAX_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    const int board_size = atoi(argv[1]);
+    if (board_size < 1 || board_size > GAME_DB_MAX_SIZE) {
+        println("Board size must be between 1 and %d, larger boards have too many positions.", GAME_DB_MAX_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    const double start_time = seconds_now();
+    game_db_build(board_size, argv[2]);
+
+    // report the value of the starting position as a sanity check
+    GameDb* db = game_db_open(argv[2]);
+    Game* game = game_create(board_size);
+    const char* names[] = {"unknown", "draw", "win", "loss"};
+    println("Solved %llu positions of the %dx%d board in %.2f s, the empty board is a %s for the first player.",
+            (unsigned long long)db->num_positions, board_size, board_size, seconds_now() - start_time,
+            names[game_db_lookup(db, game)]);
+
+    game_free(game);
+    game_db_close(db);
+    return EXIT_SUCCESS;
+}
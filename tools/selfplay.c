@@ -0,0 +1,470 @@
+//
+// Created on 16.10.2026.
+//
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "game_encoding.h"
+#include "unchecked.h"
+#include "utils/functions/std_utils.h"
+
+// format version written into the file header, bump it when the layout of the samples changes
+#define SELFPLAY_VERSION 1
+#define SELFPLAY_DEFAULT_ROLLOUTS 64
+#define SELFPLAY_DEFAULT_QUEUE_CAPACITY 1024
+
+typedef enum
+{
+    POLICY_RANDOM = 0, // uniformly random moves
+    POLICY_ROLLOUT = 1, // the move with the best flat rollout value
+} SelfplayPolicy;
+
+/**
+ * Header of the output file. It's followed by the samples, each one a position encoded with game_encode, then the
+ * outcome (int8, 1 if the player to move won the game, -1 if they lost, 0 for draw), 3 zero bytes and the rollout value
+ * of the position from the perspective of the player to move (float, little-endian).
+ */
+typedef struct
+{
+    char magic[8]; // "OXOXSELF" (not null-terminated)
+    uint32_t version;
+    uint32_t sample_size; // bytes per sample
+    uint8_t board_size;
+    uint8_t policy; // SelfplayPolicy
+    uint8_t reserved[2];
+    uint32_t num_rollouts; // random plays per rollout value
+} SelfplayHeader;
+
+_Static_assert(sizeof(SelfplayHeader) == 24, "Self-play header must not contain padding.");
+
+// samples of one finished game, passed from a worker to the writer
+typedef struct
+{
+    uint16_t num_samples;
+    uint8_t data[]; // num_samples * sample_size bytes, ready to be written
+} SelfplayGame;
+
+typedef struct
+{
+    _Atomic size_t sequence; // position the cell expects next, tells producers and consumers whose turn it is
+    SelfplayGame* game;
+} QueueCell;
+
+/**
+ * Bounded lock-free queue for any number of producers and consumers. Every cell carries a sequence number, so a thread
+ * claims a position with one compare-and-swap and then owns the cell without further synchronization.
+ */
+typedef struct
+{
+    QueueCell* cells;
+    size_t mask; // capacity - 1, the capacity is a power of 2
+    alignas(64) _Atomic size_t enqueue_position;
+    alignas(64) _Atomic size_t dequeue_position;
+} GameQueue;
+
+// settings shared by all the workers
+typedef struct
+{
+    uint8_t board_size;
+    SelfplayPolicy policy;
+    unsigned int num_rollouts;
+    unsigned int num_games;
+    size_t sample_size;
+    GameQueue* queue;
+    _Atomic unsigned int claimed_games; // games started by all the workers
+    _Atomic unsigned int finished_workers;
+    _Atomic unsigned long long producer_stalls; // pushes that found the queue full
+} SelfplayShared;
+
+typedef struct
+{
+    SelfplayShared* shared;
+    pthread_t thread;
+    Rng rng;
+} SelfplayWorker;
+
+static void queue_init(GameQueue* queue, const size_t capacity) {
+    queue->cells = malloc(capacity * sizeof(QueueCell));
+    if (queue->cells == NULL) {
+        throw_err("queue_init", "Couldn't allocate memory for the queue.");
+    }
+
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&queue->cells[i].sequence, i);
+    }
+    queue->mask = capacity - 1;
+    atomic_init(&queue->enqueue_position, 0);
+    atomic_init(&queue->dequeue_position, 0);
+}
+
+/**
+ * Add a game to the queue.
+ * @return False if the queue is full.
+ */
+static bool queue_push(GameQueue* queue, SelfplayGame* game) {
+    size_t position = atomic_load_explicit(&queue->enqueue_position, memory_order_relaxed);
+    QueueCell* cell;
+
+    while (true) {
+        cell = &queue->cells[position & queue->mask];
+        const size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0) {
+            // the cell is free, claim it (on failure the position is reloaded)
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_position, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (difference < 0) {
+            // the cell still holds the game from one lap ago
+            return false;
+        }
+        else {
+            position = atomic_load_explicit(&queue->enqueue_position, memory_order_relaxed);
+        }
+    }
+
+    cell->game = game;
+    atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Take the oldest game from the queue.
+ * @return The game, or NULL if the queue is empty.
+ */
+static SelfplayGame* queue_pop(GameQueue* queue) {
+    size_t position = atomic_load_explicit(&queue->dequeue_position, memory_order_relaxed);
+    QueueCell* cell;
+
+    while (true) {
+        cell = &queue->cells[position & queue->mask];
+        const size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_position, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (difference < 0) {
+            return NULL;
+        }
+        else {
+            position = atomic_load_explicit(&queue->dequeue_position, memory_order_relaxed);
+        }
+    }
+
+    SelfplayGame* game = cell->game;
+    // free the cell for the producer one lap ahead
+    atomic_store_explicit(&cell->sequence, position + queue->mask + 1, memory_order_release);
+    return game;
+}
+
+/**
+ * Return the approximate number of games in the queue.
+ */
+static size_t queue_depth(GameQueue* queue) {
+    const size_t dequeued = atomic_load_explicit(&queue->dequeue_position, memory_order_relaxed);
+    const size_t enqueued = atomic_load_explicit(&queue->enqueue_position, memory_order_relaxed);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+/**
+ * Pick the move with the best flat rollout value, an immediately winning move is picked right away.
+ * @return Index of the picked tile in the tile buffer.
+ */
+static uint16_t pick_rollout_move(Game* game, const uint16_t* tiles, const uint16_t num_tiles,
+                                  const unsigned int num_rollouts, RolloutScratch* scratch, Rng* rng) {
+    const uint8_t board_size = game->board->board_size;
+    uint16_t best = 0;
+    float best_value = -2;
+
+    for (uint16_t i = 0; i < num_tiles; i++) {
+        const uint8_t x = tiles[i] % board_size;
+        const uint8_t y = tiles[i] / board_size;
+
+        game_move_unchecked(game, x, y);
+        const bool win = game_is_win(game);
+        // the rollout value of the child is from the opponent's perspective
+        const float value = win ? 1 : -game_rollout_rng(game, num_rollouts, scratch, rng);
+        game_un_move_unchecked(game, x, y);
+
+        if (win) {
+            return i;
+        }
+        if (value > best_value) {
+            best_value = value;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Thread entry point, play games until all of them are claimed and push their samples to the queue.
+ * @param argument Pointer to the SelfplayWorker.
+ * @return Always NULL.
+ */
+static void* selfplay_worker_run(void* argument) {
+    SelfplayWorker* worker = argument;
+    SelfplayShared* shared = worker->shared;
+    const uint8_t board_size = shared->board_size;
+    const uint16_t num_tiles = board_size * board_size;
+
+    Game* empty = game_create(board_size);
+    Game* game = game_create(board_size);
+    RolloutScratch* scratch = rollout_scratch_create(board_size);
+    uint16_t* tiles = malloc(num_tiles * sizeof(uint16_t));
+    PlayerMark* movers = malloc(num_tiles * sizeof(PlayerMark));
+    if (tiles == NULL || movers == NULL) {
+        throw_err("selfplay_worker_run", "Couldn't allocate memory for a worker.");
+    }
+
+    while (atomic_fetch_add_explicit(&shared->claimed_games, 1, memory_order_relaxed) < shared->num_games) {
+        // a game visits at most one position per tile
+        SelfplayGame* samples = malloc(sizeof(SelfplayGame) + num_tiles * shared->sample_size);
+        if (samples == NULL) {
+            throw_err("selfplay_worker_run", "Couldn't allocate memory for the samples.");
+        }
+
+        game_copy_into(game, empty);
+        PlayerMark winner = EMPTY;
+        uint16_t num_samples = 0;
+
+        while (winner == EMPTY && !game_is_tie(game)) {
+            // label the position, the outcome is filled in when the game ends
+            uint8_t* sample = samples->data + num_samples * shared->sample_size;
+            const size_t encoded_size = game_encode(game, sample);
+            const float value = game_rollout_rng(game, shared->num_rollouts, scratch, &worker->rng);
+            uint32_t value_bits;
+            memcpy(&value_bits, &value, sizeof(value_bits));
+            memset(sample + encoded_size, 0, 4);
+            for (uint8_t i = 0; i < 4; i++) {
+                sample[encoded_size + 4 + i] = (uint8_t)(value_bits >> (i * 8));
+            }
+            movers[num_samples++] = game->current_player;
+
+            const uint16_t num_legal = board_get_legal_tiles(tiles, game->board);
+            const uint16_t pick = shared->policy == POLICY_RANDOM
+                                      ? rng_below(&worker->rng, num_legal)
+                                      : pick_rollout_move(game, tiles, num_legal, shared->num_rollouts, scratch,
+                                                          &worker->rng);
+
+            game_move_unchecked(game, tiles[pick] % board_size, tiles[pick] / board_size);
+            if (game_is_win(game)) {
+                winner = movers[num_samples - 1];
+            }
+        }
+
+        for (uint16_t i = 0; i < num_samples; i++) {
+            const int8_t outcome = winner == EMPTY ? 0 : winner == movers[i] ? 1 : -1;
+            samples->data[i * shared->sample_size + shared->sample_size - 8] = (uint8_t)outcome;
+        }
+        samples->num_samples = num_samples;
+
+        // wait for the writer when the queue is full
+        while (!queue_push(shared->queue, samples)) {
+            atomic_fetch_add_explicit(&shared->producer_stalls, 1, memory_order_relaxed);
+            sched_yield();
+        }
+    }
+
+    game_free(empty);
+    game_free(game);
+    rollout_scratch_free(scratch);
+    free(tiles);
+    free(movers);
+
+    atomic_fetch_add_explicit(&shared->finished_workers, 1, memory_order_release);
+    return NULL;
+}
+
+/**
+ * Parse a positive integer argument.
+ */
+static unsigned long parse_positive(const char* text, const char* name) {
+    char* end;
+    const unsigned long value = strtoul(text, &end, 10);
+    if (*text == '\0' || *end != '\0' || value == 0) {
+        throw_err("oxox_selfplay", "%s must be a positive integer, got \"%s\".", name, text);
+    }
+    return value;
+}
+
+// usage: oxox_selfplay <board size> <number of games> <output file> [options]
+int main(const int argc, char** argv) {
+    if (argc < 4) {
+        println("Usage: %s <board size> <number of games> <output file> [--policy random|rollout] [--rollouts <n>] "
+                "[--threads <n>] [--seed <n>] [--queue <capacity>]",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const unsigned long board_size = parse_positive(argv[1], "Board size");
+    if (board_size > 255) {
+        println("Board size must be between 1 and 255.");
+        return EXIT_FAILURE;
+    }
+
+    SelfplayShared shared;
+    shared.board_size = board_size;
+    shared.num_games = parse_positive(argv[2], "Number of games");
+    shared.policy = POLICY_RANDOM;
+    shared.num_rollouts = SELFPLAY_DEFAULT_ROLLOUTS;
+    const long num_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned long num_threads = num_processors > 0 ? num_processors : 1;
+    unsigned long long seed = 1;
+    unsigned long queue_capacity = SELFPLAY_DEFAULT_QUEUE_CAPACITY;
+
+    for (int i = 4; i < argc; i++) {
+        if (i + 1 >= argc) {
+            println("Option %s needs a value.", argv[i]);
+            return EXIT_FAILURE;
+        }
+
+        const char* option = argv[i];
+        const char* value = argv[++i];
+        if (strcmp(option, "--policy") == 0 && strcmp(value, "random") == 0) {
+            shared.policy = POLICY_RANDOM;
+        }
+        else if (strcmp(option, "--policy") == 0 && strcmp(value, "rollout") == 0) {
+            shared.policy = POLICY_ROLLOUT;
+        }
+        else if (strcmp(option, "--rollouts") == 0) {
+            shared.num_rollouts = parse_positive(value, "Number of rollouts");
+        }
+        else if (strcmp(option, "--threads") == 0) {
+            num_threads = parse_positive(value, "Number of threads");
+        }
+        else if (strcmp(option, "--seed") == 0) {
+            seed = strtoull(value, NULL, 10);
+        }
+        else if (strcmp(option, "--queue") == 0) {
+            queue_capacity = parse_positive(value, "Queue capacity");
+            if ((queue_capacity & (queue_capacity - 1)) != 0) {
+                println("Queue capacity must be a power of 2.");
+                return EXIT_FAILURE;
+            }
+        }
+        else {
+            println("Unknown option %s %s.", option, value);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // outcome, padding and value after the encoded position
+    shared.sample_size = game_encoded_size(shared.board_size) + 8;
+
+    FILE* file = fopen(argv[3], "wb");
+    if (file == NULL) {
+        throw_err("oxox_selfplay", "Couldn't create the file %s.", argv[3]);
+        return EXIT_FAILURE;
+    }
+
+    SelfplayHeader header = {0};
+    memcpy(header.magic, "OXOXSELF", sizeof(header.magic));
+    header.version = SELFPLAY_VERSION;
+    header.sample_size = shared.sample_size;
+    header.board_size = shared.board_size;
+    header.policy = shared.policy;
+    header.num_rollouts = shared.num_rollouts;
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        throw_err("oxox_selfplay", "Couldn't write to %s.", argv[3]);
+    }
+
+    GameQueue queue;
+    queue_init(&queue, queue_capacity);
+    shared.queue = &queue;
+    atomic_init(&shared.claimed_games, 0);
+    atomic_init(&shared.finished_workers, 0);
+    atomic_init(&shared.producer_stalls, 0);
+
+    SelfplayWorker* workers = malloc(num_threads * sizeof(SelfplayWorker));
+    if (workers == NULL) {
+        throw_err("oxox_selfplay", "Couldn't allocate memory for the workers.");
+        return EXIT_FAILURE;
+    }
+
+    const double start_time = seconds_now();
+
+    // every worker gets its own stream split from the seed
+    Rng rng;
+    rng_seed(&rng, seed);
+    for (unsigned long i = 0; i < num_threads; i++) {
+        workers[i].shared = &shared;
+        workers[i].rng = rng_split(&rng);
+        if (pthread_create(&workers[i].thread, NULL, selfplay_worker_run, &workers[i]) != 0) {
+            throw_err("oxox_selfplay", "Couldn't start a worker thread.");
+        }
+    }
+
+    // the main thread is the writer, it drains the queue until all the workers are done and the queue is empty
+    unsigned long long num_written_games = 0;
+    unsigned long long num_samples = 0;
+    unsigned long long depth_sum = 0;
+    size_t max_depth = 0;
+    unsigned long long idle_polls = 0;
+
+    while (true) {
+        const size_t depth = queue_depth(&queue);
+        SelfplayGame* game = queue_pop(&queue);
+
+        if (game == NULL) {
+            // checking the workers first means no game can be pushed after the final empty check
+            const bool workers_done =
+                atomic_load_explicit(&shared.finished_workers, memory_order_acquire) == num_threads;
+            if (workers_done && queue_depth(&queue) == 0) {
+                break;
+            }
+
+            // games take much longer to play than to write, so the writer sleeps instead of spinning on a core
+            idle_polls++;
+            nanosleep(&(struct timespec){.tv_sec = 0, .tv_nsec = 50000}, NULL);
+            continue;
+        }
+
+        depth_sum += depth;
+        max_depth = depth > max_depth ? depth : max_depth;
+
+        const size_t num_bytes = game->num_samples * shared.sample_size;
+        if (fwrite(game->data, 1, num_bytes, file) != num_bytes) {
+            throw_err("oxox_selfplay", "Couldn't write to %s.", argv[3]);
+        }
+
+        num_written_games++;
+        num_samples += game->num_samples;
+        free(game);
+    }
+
+    for (unsigned long i = 0; i < num_threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    fclose(file);
+
+    const double seconds = seconds_now() - start_time;
+    const double megabytes = (double)(sizeof(header) + num_samples * shared.sample_size) / (1024 * 1024);
+    println("Played %llu games of %dx%d (%llu positions) on %lu threads in %.2f s: %.1f games/s, %.0f positions/s, "
+            "%.2f MB/s.",
+            num_written_games, shared.board_size, shared.board_size, num_samples, num_threads, seconds,
+            num_written_games / seconds, num_samples / seconds, megabytes / seconds);
+    println("Queue: capacity %lu, average depth %.1f, maximum depth %zu, %llu producer stalls, %llu writer idle polls.",
+            queue_capacity, num_written_games > 0 ? (double)depth_sum / num_written_games : 0.0, max_depth,
+            (unsigned long long)atomic_load(&shared.producer_stalls), idle_polls);
+
+    free(workers);
+    free(queue.cells);
+    return EXIT_SUCCESS;
+}